@@ -1200,8 +1200,14 @@ void Compiler::IdentifierNew(String *name, const scanner::Loc *loc, SymbolType t
     if (this->unit_->local.required < this->unit_->local.current)
         this->unit_->local.required++;
 
-    if (!emit && !ListAppend(this->unit_->lnames, (ArObject *) name))
-        throw DatatypeException();
+    if (!emit) {
+        ARC iname;
+
+        // Interned, so that keyword arguments can be matched by identity (see CompileCallKWNames)
+        iname = StringIntern((const char *) ARGON_RAW_STRING(name), ARGON_RAW_STRING_LENGTH(name));
+        if (!iname || !ListAppend(this->unit_->lnames, iname.Get()))
+            throw DatatypeException();
+    }
 }
 
 void Compiler::IdentifierNew(const node::Unary *id, SymbolType type, AttributeFlag aflags, bool emit) {
@@ -1313,6 +1319,24 @@ void Compiler::CompileCallKWArgs(List *args, unsigned short &count, vm::OpCodeCa
     bool dict_expansion = false;
     int items = 0;
 
+    while ((arg = IteratorNext(iter.Get()))) {
+        if (((const node::Parameter *) arg.Get())->node_type == node::NodeType::KWARG) {
+            dict_expansion = true;
+            break;
+        }
+    }
+
+    if (!dict_expansion && ENUMBITMASK_ISFALSE(mode, vm::OpCodeCallMode::REST_PARAMS)) {
+        this->CompileCallKWNames(args, count, mode);
+        return;
+    }
+
+    iter = IteratorGet((ArObject *) args, false);
+    if (!iter)
+        throw DatatypeException();
+
+    dict_expansion = false;
+
     // key = value
     while ((arg = IteratorNext(iter.Get()))) {
         const auto *tmp = (const node::Parameter *) arg.Get();
@@ -1366,6 +1390,45 @@ void Compiler::CompileCallKWArgs(List *args, unsigned short &count, vm::OpCodeCa
     count++;
 }
 
+void Compiler::CompileCallKWNames(List *args, unsigned short &count, vm::OpCodeCallMode &mode) {
+    ARC names;
+    ARC iter;
+    ARC arg;
+
+    names = TupleNew(args->length);
+    if (!names)
+        throw DatatypeException();
+
+    iter = IteratorGet((ArObject *) args, false);
+    if (!iter)
+        throw DatatypeException();
+
+    // value, ..., (key, ...)
+    unsigned short items = 0;
+    while ((arg = IteratorNext(iter.Get()))) {
+        const auto *tmp = (const node::Parameter *) arg.Get();
+        ARC name;
+
+        // Names are interned, so the callee can match them by identity
+        name = StringIntern((const char *) ARGON_RAW_STRING(tmp->id), ARGON_RAW_STRING_LENGTH(tmp->id));
+        if (!name)
+            throw DatatypeException();
+
+        TupleInsert((Tuple *) names.Get(), name.Get(), items++);
+
+        if (tmp->value != nullptr)
+            this->Expression(tmp->value);
+        else
+            this->LoadStaticNil(&tmp->loc, true);
+    }
+
+    this->LoadStatic(names.Get(), nullptr, true, true);
+
+    mode |= vm::OpCodeCallMode::KW_PARAMS | vm::OpCodeCallMode::KW_NAMES;
+
+    count += items + 1;
+}
+
 void Compiler::CompileCallPositional(List *args, unsigned short &count, vm::OpCodeCallMode &mode) {
     ARC iter;
     ARC arg;
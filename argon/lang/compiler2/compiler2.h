@@ -110,6 +110,8 @@ namespace argon::lang::compiler2 {
 
         void CompileCallKWArgs(List *args, unsigned short &count, vm::OpCodeCallMode &mode);
 
+        void CompileCallKWNames(List *args, unsigned short &count, vm::OpCodeCallMode &mode);
+
         void CompileCallPositional(List *args, unsigned short &count, vm::OpCodeCallMode &mode);
 
         void CompileDLST(const parser2::node::Unary *unary);
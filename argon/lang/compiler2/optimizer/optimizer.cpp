@@ -216,11 +216,22 @@ void CodeOptimizer::OptimizeJMP() {
     }
 }
 
+void CodeOptimizer::OptimizeSuperInstr() {
+    for (auto *block = this->unit_->bbb.begin; block != nullptr; block = block->next) {
+        for (auto *instr = block->instr.head; instr != nullptr && instr->next != nullptr; instr = instr->next)
+            instr->opcode = (unsigned char) vm::FuseOpCode((vm::OpCode) instr->opcode,
+                                                           (vm::OpCode) instr->next->opcode);
+    }
+}
+
 bool CodeOptimizer::optimize() {
     switch (this->level_) {
         case OptimizationLevel::HARD:
         case OptimizationLevel::MEDIUM:
             this->OptimizeConstOP();
+            this->OptimizeJMP();
+            this->OptimizeSuperInstr();
+            break;
         case OptimizationLevel::SOFT:
             this->OptimizeJMP();
             break;
@@ -22,6 +22,8 @@ namespace argon::lang::compiler2 {
 
         void OptimizeJMP();
 
+        void OptimizeSuperInstr();
+
     public:
         explicit CodeOptimizer(TranslationUnit *unit, OptimizationLevel level) : unit_(unit), level_(level) {}
 
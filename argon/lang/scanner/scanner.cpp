@@ -369,6 +369,12 @@ bool Scanner::TokenizeComment(Token *out_token, bool inline_comment) {
     if (peek == 0)
         return false;
 
+    // End of input before */
+    if (peek < 0 && !inline_comment) {
+        this->status_ = ScannerStatus::INVALID_COMMENT;
+        return false;
+    }
+
     out_token->type = type;
     out_token->loc.end = this->loc;
     out_token->length = this->sbuf_.GetBuffer(&out_token->buffer);
@@ -921,6 +927,7 @@ const char *Scanner::GetStatusMessage() const {
             "byte string can only contain ASCII literal characters",
             "can't decode bytes in unicode sequence, escape format must be: \\Uhhhhhhhh",
             "can't decode bytes in unicode sequence, escape format must be: \\uhhhh",
+            "unterminated comment",
             "can't decode byte, hex escape must be: \\xhh",
             "invalid hexadecimal literal",
             "expected new-line after line continuation character",
@@ -23,6 +23,7 @@ namespace argon::lang::scanner {
         INVALID_BSTR,
         INVALID_BYTE_ULONG,
         INVALID_BYTE_USHORT,
+        INVALID_COMMENT,
         INVALID_HEX_BYTE,
         INVALID_HEX_LITERAL,
         INVALID_LC,
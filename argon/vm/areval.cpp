@@ -9,6 +9,7 @@
 #include <argon/vm/datatype/error.h>
 #include <argon/vm/datatype/function.h>
 #include <argon/vm/datatype/future.h>
+#include <argon/vm/datatype/integer.h>
 #include <argon/vm/datatype/nil.h>
 #include <argon/vm/datatype/module.h>
 #include <argon/vm/datatype/set.h>
@@ -17,7 +18,9 @@
 #include <argon/vm/importer/import.h>
 
 #include <argon/vm/defer.h>
+#include <argon/vm/jit.h>
 #include <argon/vm/opcode.h>
+#include <argon/vm/profiler.h>
 #include <argon/vm/runtime.h>
 #include <argon/vm/areval.h>
 
@@ -93,6 +96,23 @@ bool STSubscribe(ArObject *subscr, ArObject *index, ArObject *value) {
     return AR_SLOT_SUBSCRIPTABLE(subscr)->set_item(subscr, index, value);
 }
 
+bool argon::vm::CompareInt(IntegerUnderlying left, IntegerUnderlying right, CompareMode mode) {
+    switch (mode) {
+        case CompareMode::EQ:
+            return left == right;
+        case CompareMode::NE:
+            return left != right;
+        case CompareMode::GR:
+            return left > right;
+        case CompareMode::GRQ:
+            return left >= right;
+        case CompareMode::LE:
+            return left < right;
+        default:
+            return left <= right;
+    }
+}
+
 bool CallDefer(Fiber *fiber, Frame **cu_frame, const Code **cu_code) {
     ArObject *ret;
     Defer *defer;
@@ -101,8 +121,7 @@ bool CallDefer(Fiber *fiber, Frame **cu_frame, const Code **cu_code) {
     defer = (*cu_frame)->defer;
 
     while (defer != nullptr && defer->function->IsNative()) {
-        ret = FunctionInvokeNative(defer->function, nullptr, 0,
-                                   ENUMBITMASK_ISTRUE(defer->mode, OpCodeCallMode::KW_PARAMS));
+        ret = FunctionInvokeNative(defer->function, nullptr, 0, defer->mode);
         Release(ret);
 
         defer = DeferPop(&(*cu_frame)->defer);
@@ -124,6 +143,54 @@ bool CallDefer(Fiber *fiber, Frame **cu_frame, const Code **cu_code) {
     return true;
 }
 
+ArSize KWParamsSlots(ArObject **args, ArSize args_length, OpCodeCallMode mode) {
+    if (ENUMBITMASK_ISTRUE(mode, OpCodeCallMode::KW_NAMES))
+        return ((Tuple *) args[args_length - 1])->length + 1;
+
+    return 1;
+}
+
+bool KWNamesToDict(ArObject **args, ArSize *args_length) {
+    // Replaces the names/values slice at the top of args with a Dict (the remaining slots are released by the caller)
+    const auto *names = (Tuple *) args[*args_length - 1];
+    auto base = *args_length - (names->length + 1);
+
+    auto *kwargs = KWArgsToDict(names, args + base);
+    if (kwargs == nullptr)
+        return false;
+
+    Replace(args + base, (ArObject *) kwargs);
+
+    *args_length = base + 1;
+
+    return true;
+}
+
+bool CallPlainFunction(Fiber *fiber, Frame **cu_frame, const Code **cu_code, Function *func, ArObject **args,
+                       ArSize stack_size) {
+    auto *old_frame = *cu_frame;
+    Frame *new_frame;
+
+    // Arguments are moved from the eval stack to the locals of the new frame
+    if ((new_frame = FrameNewPlain(fiber, func, args)) == nullptr)
+        return false;
+
+    old_frame->eval_stack -= stack_size;
+    old_frame->instr_ptr += 4;
+
+#ifdef ARGON_FF_PROFILER
+    if (profiler::IsEnabled())
+        profiler::TrackCall(new_frame->code);
+#endif
+
+    *cu_frame = new_frame;
+    *cu_code = new_frame->code;
+
+    FiberPushFrame(fiber, new_frame);
+
+    return true;
+}
+
 bool CallFunction(Fiber *fiber, Frame **cu_frame, const Code **cu_code, bool validate_only) {
     ArObject **eval_stack;
     ArObject **args;
@@ -144,7 +211,6 @@ bool CallFunction(Fiber *fiber, Frame **cu_frame, const Code **cu_code, bool val
     mode = I32Flag<OpCodeCallMode>((*cu_frame)->instr_ptr);
 
     eval_stack = (*cu_frame)->eval_stack - stack_size;
-    func = (Function *) GetCallableFromType((*cu_frame)->eval_stack - (stack_size + 1));
 
     args = eval_stack;
     args_length = stack_size;
@@ -154,6 +220,15 @@ bool CallFunction(Fiber *fiber, Frame **cu_frame, const Code **cu_code, bool val
         args_length--;
     }
 
+    func = (Function *) *((*cu_frame)->eval_stack - (stack_size + 1));
+
+    // Fast path: plain Argon function called with exactly arity positional arguments
+    if (mode == OpCodeCallMode::FASTCALL && !validate_only && AR_TYPEOF(func, type_function_)
+        && func->IsPlain() && args_length == func->arity)
+        return CallPlainFunction(fiber, cu_frame, cu_code, func, args, stack_size);
+
+    func = (Function *) GetCallableFromType((*cu_frame)->eval_stack - (stack_size + 1));
+
     if (!AR_TYPEOF(func, type_function_)) {
         ErrorFormat(kTypeError[0], kTypeError[9], AR_TYPE_NAME(func));
         return false;
@@ -175,7 +250,7 @@ bool CallFunction(Fiber *fiber, Frame **cu_frame, const Code **cu_code, bool val
             return false;
         }
 
-        positional_args--;
+        positional_args -= KWParamsSlots(args, args_length, mode);
     }
 
     ret = nullptr;
@@ -186,6 +261,9 @@ bool CallFunction(Fiber *fiber, Frame **cu_frame, const Code **cu_code, bool val
             return false;
         }
 
+        if (ENUMBITMASK_ISTRUE(mode, OpCodeCallMode::KW_NAMES) && !KWNamesToDict(args, &args_length))
+            return false;
+
         ret = (ArObject *) FunctionNew(func, args, args_length);
         goto CLEANUP;
     }
@@ -201,7 +279,7 @@ bool CallFunction(Fiber *fiber, Frame **cu_frame, const Code **cu_code, bool val
     new_frame = nullptr;
 
     if (func->IsNative()) {
-        ret = FunctionInvokeNative(func, args, args_length, ENUMBITMASK_ISTRUE(mode, OpCodeCallMode::KW_PARAMS));
+        ret = FunctionInvokeNative(func, args, args_length, mode);
         if (ret == nullptr) {
             auto f_status = GetFiberStatus();
             if (f_status == FiberStatus::SUSPENDED || f_status == FiberStatus::BLOCKED_SUSPENDED)
@@ -243,6 +321,11 @@ bool CallFunction(Fiber *fiber, Frame **cu_frame, const Code **cu_code, bool val
 
     assert(new_frame != nullptr);
 
+#ifdef ARGON_FF_PROFILER
+    if (profiler::IsEnabled())
+        profiler::TrackCall(new_frame->code);
+#endif
+
     *cu_frame = new_frame;
     *cu_code = new_frame->code;
 
@@ -262,6 +345,124 @@ bool CallFunction(Fiber *fiber, Frame **cu_frame, const Code **cu_code, bool val
     return exit_ok;
 }
 
+ArObject *LoadAttribute(const Code *code, const ArObject *instance, const unsigned char *ip, bool *is_method) {
+    auto *cache = code->GetAttributeCache(ip);
+    auto index = I32Arg(ip);
+    ArObject *ret;
+
+    if (cache != nullptr) {
+        if (is_method != nullptr)
+            return AttributeLoadMethodCached(instance, cache, is_method);
+
+        return AttributeLoadCached(instance, cache);
+    }
+
+    auto *key = TupleGet(code->statics, index);
+    if (key == nullptr) {
+        DiscardLastPanic();
+
+        ErrorFormat(kRuntimeError[0], kRuntimeError[3], index, code->statics->length);
+
+        return nullptr;
+    }
+
+    if (is_method != nullptr)
+        ret = AttributeLoadMethod(instance, key, is_method);
+    else
+        ret = AttributeLoad(instance, key, false);
+
+    Release(key);
+
+    return ret;
+}
+
+constexpr std::uint64_t kGlobalCacheBusy = ~((std::uint64_t) 0);
+
+ArObject *LoadGlobal(const Code *code, Namespace *globals, Namespace *builtins, unsigned char index) {
+    GlobalCache *cache = nullptr;
+    AttributeProperty aprop{};
+    ArObject *ret;
+
+    auto g_version = globals->version.load(std::memory_order_acquire);
+    auto b_version = builtins->version.load(std::memory_order_acquire);
+
+    if (code->gbl_cache != nullptr) {
+        cache = code->gbl_cache + index;
+
+        // The cache owns a reference to value and never releases it before the Code object, so it remains valid even if the check fails
+        if (cache->globals_version.load(std::memory_order_acquire) == g_version) {
+            ret = cache->value.load(std::memory_order_relaxed);
+            auto c_version = cache->builtins_version.load(std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (c_version == b_version && cache->globals_version.load(std::memory_order_relaxed) == g_version)
+                return IncRef(ret);
+        }
+    }
+
+    auto *key = TupleGet(code->names, index);
+
+    if ((ret = NamespaceLookup(globals, key, &aprop)) == nullptr)
+        ret = NamespaceLookup(builtins, key, &aprop);
+
+    if (ret == nullptr) {
+        ErrorFormat(kUndeclaredeError[0], kUndeclaredeError[1], ARGON_RAW_STRING((String *) key));
+
+        Release(key);
+
+        return nullptr;
+    }
+
+    Release(key);
+
+    // Only constant symbols (functions, structs, imports, builtins...) are cached
+    if (cache == nullptr || !aprop.IsConstant() || aprop.IsWeak())
+        return ret;
+
+    // Another thread is filling the cache, let it go
+    auto current = cache->globals_version.load(std::memory_order_relaxed);
+    if (current == kGlobalCacheBusy
+        || !cache->globals_version.compare_exchange_strong(current, kGlobalCacheBusy, std::memory_order_relaxed))
+        return ret;
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    auto *cached = cache->value.load(std::memory_order_relaxed);
+    if (cached != ret) {
+        if (cached != nullptr) {
+            /*
+             * The symbol has been rebound. Releasing the previous value here could free it while another fiber
+             * is still reading it, so it is retired until the Code object is released. A symbol that keeps being
+             * rebound is no longer followed, its slot keeps missing.
+             */
+            GlobalCacheRetired *retired = nullptr;
+
+            if (cache->refills >= kGlobalCacheMaxRefills
+                || (retired = (GlobalCacheRetired *) memory::Alloc(sizeof(GlobalCacheRetired))) == nullptr) {
+                if (retired == nullptr)
+                    DiscardLastPanic();
+
+                cache->globals_version.store(current, std::memory_order_release);
+                return ret;
+            }
+
+            retired->value = cached;
+            retired->next = cache->retired;
+
+            cache->retired = retired;
+            cache->refills++;
+        }
+
+        cache->value.store(IncRef(ret), std::memory_order_relaxed);
+    }
+
+    cache->builtins_version.store(b_version, std::memory_order_relaxed);
+    cache->globals_version.store(g_version, std::memory_order_release);
+
+    return ret;
+}
+
 bool PopExecutedFrame(Fiber *fiber, const Code **out_code, Frame **out_frame, ArObject **ret) {
     auto *cu_frame = *out_frame;
     auto is_panicking = IsPanickingFrame();
@@ -351,32 +552,17 @@ bool Spawn(Frame *cu_frame) {
 
     positional_args = args_length;
 
-    if (func->currying != nullptr)
-        positional_args += func->currying->length;
-
     if (ENUMBITMASK_ISTRUE(mode, OpCodeCallMode::KW_PARAMS)) {
         if (!func->IsKWArgs() && !func->HaveDefaults()) {
             ErrorFormat(kTypeError[0], kTypeError[4], ARGON_RAW_STRING(func->qname));
             return false;
         }
 
-        positional_args--;
-    }
-
-    if (positional_args < func->arity) {
-        ErrorFormat(kTypeError[0], kTypeError[3], ARGON_RAW_STRING(func->qname), func->arity, positional_args);
-        return false;
-    }
-
-    if (positional_args > func->arity && !func->IsVariadic()) {
-        ErrorFormat(kTypeError[0], kTypeError[3], ARGON_RAW_STRING(func->qname), func->arity, positional_args);
-        return false;
+        positional_args -= KWParamsSlots(args, args_length, mode);
     }
 
-    if (func->IsGenerator()) {
-        ErrorFormat(kTypeError[0], kTypeError[6], "spawn", ARGON_RAW_STRING(func->qname));
+    if (!FunctionCheckSpawnable(func, positional_args))
         return false;
-    }
 
     bool ok = Spawn(func, args, args_length, mode);
 
@@ -432,8 +618,15 @@ ArObject *argon::vm::Eval(Fiber *fiber) {
       case OpCode::op:  \
       LBL_##op:
 
+#ifdef ARGON_FF_PROFILER
+// While profiling, every instruction goes through the top of the dispatch loop
+#define CGOTO                                       \
+    if (profiler::IsEnabled()) continue;            \
+    goto *LBL_OPCODES[(unsigned char) LoadOpCode(cu_frame->instr_ptr)]
+#else
 #define CGOTO \
-    goto *LBL_OPCODES[*(cu_frame->instr_ptr)]
+    goto *LBL_OPCODES[(unsigned char) LoadOpCode(cu_frame->instr_ptr)]
+#endif
 
     static const void *LBL_OPCODES[] = {
             &&LBL_ADD,
@@ -518,13 +711,24 @@ ArObject *argon::vm::Eval(Fiber *fiber) {
             &&LBL_TSTORE,
             &&LBL_UNPACK,
             &&LBL_UNSYNC,
-            &&LBL_YLD
+            &&LBL_YLD,
+            &&LBL_ADD_INT_INT,
+            &&LBL_CMP_INT_INT,
+            &&LBL_IPADD_INT,
+            &&LBL_IPADD_STR,
+            &&LBL_MUL_INT_INT,
+            &&LBL_SUB_INT_INT,
+            &&LBL_CMP_JF,
+            &&LBL_LDLC_LDATTR,
+            &&LBL_LDLC_LDLC,
+            &&LBL_LDMETH_CALL,
+            &&LBL_PSHC_POP
     };
 #endif
 
 // STACK MANIPULATION MACRO
-#define DISPATCH()                                                  \
-    cu_frame->instr_ptr += OpCodeOffset[*cu_frame->instr_ptr];      \
+#define DISPATCH()                                                                  \
+    cu_frame->instr_ptr += OpCodeOffset[(unsigned char) LoadOpCode(cu_frame->instr_ptr)];  \
     CGOTO
 
 #define DISPATCH1()                                                 \
@@ -544,6 +748,45 @@ ArObject *argon::vm::Eval(Fiber *fiber) {
     if(GetFiberStatus() != FiberStatus::RUNNING) return nullptr;    \
     CGOTO
 
+// Consumes one unit of the fiber time slice, when it runs out the fiber is suspended (and requeued by the Scheduler).
+// A fiber running inside EvalSync is never preempted, the native caller is waiting for it on the OS stack
+// Only the top-level Eval of a fiber is a safe point, a nested one (EvalSync) may run under a native that holds locks
+#define PREEMPTION_POINT()                                                              \
+    if (fiber->unwind_limit == nullptr) {                                               \
+        if (memory::GCSafePointRequested()) {                                           \
+            memory::GCSafePoint();                                                      \
+            if (IsPanickingFrame())                                                     \
+                break;                                                                  \
+        }                                                                               \
+                                                                                        \
+        if (fiber->slice > 0 && --fiber->slice == 0) {                                  \
+            SetFiberStatus(FiberStatus::SUSPENDED);                                     \
+            return nullptr;                                                             \
+        }                                                                               \
+    }
+
+// Runs the machine code of a hot Code object from cu_frame->instr_ptr (see jit::Enter), if it stops
+// on an instruction that it does not translate, the interpreter resumes from there
+#define JIT_POINT()                                                                     \
+    if (jit::IsEnabled()) {                                                             \
+        auto jit_status = jit::Enter(fiber, cu_frame);                                  \
+                                                                                        \
+        if (jit_status == jit::JITStatus::SUSPEND)                                      \
+            return nullptr;                                                             \
+                                                                                        \
+        if (jit_status == jit::JITStatus::BREAK)                                        \
+            break;                                                                      \
+    }
+
+// QUICKENING MACRO
+#define QUICKEN(op) StoreOpCode(cu_frame->instr_ptr, OpCode::op)
+
+// After too many type guard failures the instruction is pinned to its generic form (see Code::CanQuicken)
+#define DEOPTIMIZE(op)                                      \
+    ((Code *) cu_code)->QuickenMiss(cu_frame->instr_ptr);   \
+    QUICKEN(op);                                            \
+    continue
+
 #define JUMPADDR(offset) (unsigned char *) (cu_code->instr + (offset))
 
 #define JUMPTO(offset)                          \
@@ -586,6 +829,40 @@ ArObject *argon::vm::Eval(Fiber *fiber) {
     TOP_REPLACE(ret);                                                                                               \
     DISPATCH1()
 
+#define INT_BINARY_OP(generic, op)                                                                                  \
+    if (!AR_TYPEOF(PEEK1(), type_int_) || !AR_TYPEOF(TOP(), type_int_)) {                                           \
+        DEOPTIMIZE(generic); }                                                                                      \
+    if ((ret = (ArObject *) IntNew(((Integer *) PEEK1())->sint op ((Integer *) TOP())->sint)) == nullptr)           \
+        break;                                                                                                      \
+    POP();                                                                                                          \
+    TOP_REPLACE(ret);                                                                                               \
+    DISPATCH1()
+
+#define QUICKEN_INT_BINARY_OP(specialized)                                                                          \
+    if (AR_TYPEOF(PEEK1(), type_int_) && AR_TYPEOF(TOP(), type_int_)                                                \
+        && cu_code->CanQuicken(cu_frame->instr_ptr)) {                                                              \
+        QUICKEN(specialized);                                                                                       \
+        continue; }
+
+#define SKIP_INPLACE_STORE()                                                                                        \
+    do {                                                                                                            \
+        auto next_op = LoadOpCode(++cu_frame->instr_ptr);                                                           \
+        POP();                                                                                                      \
+        if (next_op == OpCode::STSUBSCR) {                                                                          \
+            POP();                                                                                                  \
+            POP();                                                                                                  \
+        } else if (next_op == OpCode::STSCOPE || next_op == OpCode::STATTR)                                         \
+            POP();                                                                                                  \
+    } while(0);                                                                                                     \
+    DISPATCH()
+
+#define INT_UNARY_OP(op)                                                                                            \
+    if (AR_TYPEOF(TOP(), type_int_)) {                                                                              \
+        if ((ret = (ArObject *) IntNew(((Integer *) TOP())->sint op 1)) == nullptr)                                \
+            break;                                                                                                  \
+        TOP_REPLACE(ret);                                                                                           \
+        DISPATCH1(); }
+
 #define UNARY_OP(op, opchar)                                                                                        \
     ret = TOP();                                                                                                    \
     if(AR_GET_TYPE(ret)->ops == nullptr || AR_GET_TYPE(ret)->ops->op == nullptr) {                                  \
@@ -601,6 +878,13 @@ ArObject *argon::vm::Eval(Fiber *fiber) {
 
     ArObject *ret = nullptr;
 
+#ifdef ARGON_FF_PROFILER
+    profiler::ProfState prof_state{};
+
+    if (profiler::IsEnabled())
+        profiler::EnterEval(&prof_state);
+#endif
+
     if (IsPanickingFrame()) {
         if ((uintptr_t) cu_frame->trap_ptr > 0)
             cu_frame->instr_ptr = cu_frame->trap_ptr;
@@ -609,9 +893,16 @@ ArObject *argon::vm::Eval(Fiber *fiber) {
     }
 
     while (cu_frame->instr_ptr < cu_code->instr_end) {
-        switch (*((OpCode *) cu_frame->instr_ptr)) {
+#ifdef ARGON_FF_PROFILER
+        if (profiler::IsEnabled())
+            profiler::TrackInstr(&prof_state, cu_frame);
+#endif
+
+        switch (LoadOpCode(cu_frame->instr_ptr)) {
             TARGET_OP(ADD)
             {
+                QUICKEN_INT_BINARY_OP(ADD_INT_INT)
+
                 BINARY_OP(add, +);
             }
             TARGET_OP(AWAIT)
@@ -641,10 +932,14 @@ ArObject *argon::vm::Eval(Fiber *fiber) {
                 if (!call_ok)
                     break;
 
+                PREEMPTION_POINT();
+                JIT_POINT();
                 continue;
             }
             TARGET_OP(CMP)
             {
+                QUICKEN_INT_BINARY_OP(CMP_INT_INT)
+
                 if ((ret = Compare(PEEK1(), TOP(), (CompareMode) I16Arg(cu_frame->instr_ptr))) == nullptr)
                     break;
 
@@ -679,6 +974,8 @@ ArObject *argon::vm::Eval(Fiber *fiber) {
             }
             TARGET_OP(DEC)
             {
+                INT_UNARY_OP(-)
+
                 UNARY_OP(dec, --);
             }
             TARGET_OP(DFR)
@@ -817,6 +1114,8 @@ ArObject *argon::vm::Eval(Fiber *fiber) {
             }
             TARGET_OP(INC)
             {
+                INT_UNARY_OP(+)
+
                 UNARY_OP(inc, ++);
             }
             TARGET_OP(INIT)
@@ -841,6 +1140,14 @@ ArObject *argon::vm::Eval(Fiber *fiber) {
             {
                 auto *actual = PEEK1();
 
+                QUICKEN_INT_BINARY_OP(IPADD_INT)
+
+                if (AR_TYPEOF(actual, type_string_) && AR_TYPEOF(TOP(), type_string_)
+                    && cu_code->CanQuicken(cu_frame->instr_ptr)) {
+                    QUICKEN(IPADD_STR);
+                    continue;
+                }
+
                 BINARY_OP4(actual, TOP(), inp_add, +=)
 
                 POP();
@@ -851,20 +1158,7 @@ ArObject *argon::vm::Eval(Fiber *fiber) {
                 }
 
                 // Skip next STORE operation
-
-                cu_frame->instr_ptr++;
-
-                auto nextI = (OpCode) *cu_frame->instr_ptr;
-
-                POP();
-
-                if (nextI == OpCode::STSUBSCR) {
-                    POP();
-                    POP();
-                } else if (nextI == OpCode::STSCOPE || nextI == OpCode::STATTR)
-                    POP();
-
-                DISPATCH();
+                SKIP_INPLACE_STORE();
             }
             TARGET_OP(IPSUB)
             {
@@ -880,20 +1174,7 @@ ArObject *argon::vm::Eval(Fiber *fiber) {
                 }
 
                 // Skip next STORE operation
-
-                cu_frame->instr_ptr++;
-
-                auto nextI = (OpCode) *cu_frame->instr_ptr;
-
-                POP();
-
-                if (nextI == OpCode::STSUBSCR) {
-                    POP();
-                    POP();
-                } else if (nextI == OpCode::STSCOPE || nextI == OpCode::STATTR)
-                    POP();
-
-                DISPATCH();
+                SKIP_INPLACE_STORE();
             }
             TARGET_OP(JEX)
             {
@@ -933,7 +1214,18 @@ ArObject *argon::vm::Eval(Fiber *fiber) {
             }
             TARGET_OP(JMP)
             {
-                JUMPTO(I32Arg(cu_frame->instr_ptr));
+                auto offset = I32Arg(cu_frame->instr_ptr);
+
+                // Backward jump (loop iteration)
+                if (JUMPADDR(offset) < cu_frame->instr_ptr) {
+                    cu_frame->instr_ptr = JUMPADDR(offset);
+
+                    PREEMPTION_POINT();
+                    JIT_POINT();
+                    continue;
+                }
+
+                JUMPTO(offset);
             }
             TARGET_OP(JNIL)
             {
@@ -982,22 +1274,7 @@ ArObject *argon::vm::Eval(Fiber *fiber) {
             }
             TARGET_OP(LDATTR)
             {
-                auto index = (ArSSize) I32Arg(cu_frame->instr_ptr);
-
-                auto *key = TupleGet(cu_code->statics, index);
-                if (key == nullptr) {
-                    DiscardLastPanic();
-
-                    ErrorFormat(kRuntimeError[0], kRuntimeError[3], index, cu_code->statics->length);
-
-                    break;
-                }
-
-                ret = AttributeLoad(TOP(), key, false);
-
-                Release(key);
-
-                if (ret == nullptr)
+                if ((ret = LoadAttribute(cu_code, TOP(), cu_frame->instr_ptr, nullptr)) == nullptr)
                     break;
 
                 TOP_REPLACE(ret);
@@ -1010,30 +1287,16 @@ ArObject *argon::vm::Eval(Fiber *fiber) {
             }
             TARGET_OP(LDGBL)
             {
-                auto *key = TupleGet(cu_code->names, I16Arg(cu_frame->instr_ptr));
-
-                if ((ret = NamespaceLookup(cu_frame->globals, key, nullptr)) != nullptr) {
-                    Release(key);
-
-                    PUSH(ret);
-                    DISPATCH4();
-                }
-
-                if ((ret = NamespaceLookup(fiber->context->builtins->ns, key, nullptr)) != nullptr) {
-                    Release(key);
-
-                    PUSH(ret);
-                    DISPATCH4();
-                }
-
-                ErrorFormat(kUndeclaredeError[0], kUndeclaredeError[1], ARGON_RAW_STRING((String *) key));
+                ret = LoadGlobal(cu_code, cu_frame->globals, fiber->context->builtins->ns,
+                                 I16Arg(cu_frame->instr_ptr));
 
-                Release(key);
+                // If nullptr, prevent crash when using 'trap' keyword with non-existent variables
+                PUSH(ret);
 
-                // Prevent crash when using 'trap' keyword with non-existent variables
-                PUSH(nullptr);
+                if (ret == nullptr)
+                    break;
 
-                break;
+                DISPATCH4();
             }
             TARGET_OP(LDITER)
             {
@@ -1062,24 +1325,10 @@ ArObject *argon::vm::Eval(Fiber *fiber) {
             }
             TARGET_OP(LDMETH)
             {
-                auto index = (ArSSize) I32Arg(cu_frame->instr_ptr);
                 auto *instance = TOP();
-
-                ArObject *key;
-                if ((key = TupleGet(cu_code->statics, index)) == nullptr) {
-                    DiscardLastPanic();
-
-                    ErrorFormat(kRuntimeError[0], kRuntimeError[3], index, cu_code->statics->length);
-
-                    break;
-                }
-
                 bool is_method;
-                ret = AttributeLoadMethod(instance, key, &is_method);
 
-                Release(key);
-
-                if (ret == nullptr)
+                if ((ret = LoadAttribute(cu_code, instance, cu_frame->instr_ptr, &is_method)) == nullptr)
                     break;
 
                 if (is_method) {
@@ -1326,6 +1575,8 @@ ArObject *argon::vm::Eval(Fiber *fiber) {
             }
             TARGET_OP(MUL)
             {
+                QUICKEN_INT_BINARY_OP(MUL_INT_INT)
+
                 BINARY_OP(mul, *);
             }
             TARGET_OP(NEG)
@@ -1595,6 +1846,8 @@ ArObject *argon::vm::Eval(Fiber *fiber) {
             }
             TARGET_OP(SUB)
             {
+                QUICKEN_INT_BINARY_OP(SUB_INT_INT)
+
                 BINARY_OP(sub, -);
             }
             TARGET_OP(SUBSCR)
@@ -1676,6 +1929,8 @@ ArObject *argon::vm::Eval(Fiber *fiber) {
                                         (AttributeFlag) I16Arg(cu_frame->instr_ptr)))
                     break;
 
+                TypeModified(base);
+
                 POP();
                 POP();
                 DISPATCH2();
@@ -1725,8 +1980,167 @@ ArObject *argon::vm::Eval(Fiber *fiber) {
 
                 continue;
             }
+            TARGET_OP(ADD_INT_INT)
+            {
+                INT_BINARY_OP(ADD, +);
+            }
+            TARGET_OP(CMP_INT_INT)
+            {
+                if (!AR_TYPEOF(PEEK1(), type_int_) || !AR_TYPEOF(TOP(), type_int_)) {
+                    DEOPTIMIZE(CMP);
+                }
+
+                ret = BoolToArBool(CompareInt(((Integer *) PEEK1())->sint, ((Integer *) TOP())->sint,
+                                              (CompareMode) I16Arg(cu_frame->instr_ptr)));
+
+                POP();
+                TOP_REPLACE(ret);
+                DISPATCH2();
+            }
+            TARGET_OP(IPADD_INT)
+            {
+                auto *actual = (Integer *) PEEK1();
+                const auto *other = (Integer *) TOP();
+
+                if (!AR_TYPEOF(actual, type_int_) || !AR_TYPEOF(other, type_int_)) {
+                    DEOPTIMIZE(IPADD);
+                }
+
+                if (!AR_SAFE_TO_MUTATE(actual)) {
+                    if ((ret = (ArObject *) IntNew(actual->sint + other->sint)) == nullptr)
+                        break;
+
+                    POP();
+                    TOP_REPLACE(ret);
+                    DISPATCH1();
+                }
+
+                actual->sint += other->sint;
+
+                POP();
+
+                // Skip next STORE operation
+                SKIP_INPLACE_STORE();
+            }
+            TARGET_OP(IPADD_STR)
+            {
+                if (!AR_TYPEOF(PEEK1(), type_string_) || !AR_TYPEOF(TOP(), type_string_)) {
+                    DEOPTIMIZE(IPADD);
+                }
+
+                if ((ret = (ArObject *) StringConcat((String *) PEEK1(), (String *) TOP())) == nullptr)
+                    break;
+
+                POP();
+                TOP_REPLACE(ret);
+                DISPATCH1();
+            }
+            TARGET_OP(MUL_INT_INT)
+            {
+                INT_BINARY_OP(MUL, *);
+            }
+            TARGET_OP(SUB_INT_INT)
+            {
+                INT_BINARY_OP(SUB, -);
+            }
+            TARGET_OP(CMP_JF)
+            {
+                auto mode = (CompareMode) I16Arg(cu_frame->instr_ptr);
+                bool result;
+
+                if (AR_TYPEOF(PEEK1(), type_int_) && AR_TYPEOF(TOP(), type_int_))
+                    result = CompareInt(((Integer *) PEEK1())->sint, ((Integer *) TOP())->sint, mode);
+                else {
+                    if ((ret = Compare(PEEK1(), TOP(), mode)) == nullptr)
+                        break;
+
+                    result = IsTrue(ret);
+
+                    Release(ret);
+                }
+
+                POP();
+                POP();
+
+                cu_frame->instr_ptr += 2;
+
+                if (!result) {
+                    JUMPTO(I32Arg(cu_frame->instr_ptr));
+                }
+
+                DISPATCH4();
+            }
+            TARGET_OP(LDLC_LDATTR)
+            {
+                PUSH(IncRef(cu_frame->locals[I16Arg(cu_frame->instr_ptr)]));
+
+                cu_frame->instr_ptr += 2;
+
+                if ((ret = LoadAttribute(cu_code, TOP(), cu_frame->instr_ptr, nullptr)) == nullptr)
+                    break;
+
+                TOP_REPLACE(ret);
+                DISPATCH4();
+            }
+            TARGET_OP(LDLC_LDLC)
+            {
+                PUSH(IncRef(cu_frame->locals[I16Arg(cu_frame->instr_ptr)]));
+                PUSH(IncRef(cu_frame->locals[I16Arg(cu_frame->instr_ptr + 2)]));
+                DISPATCH4();
+            }
+            TARGET_OP(LDMETH_CALL)
+            {
+                auto *instance = TOP();
+                bool is_method;
+
+                if ((ret = LoadAttribute(cu_code, instance, cu_frame->instr_ptr, &is_method)) == nullptr)
+                    break;
+
+                if (is_method) {
+                    *(cu_frame->eval_stack - 1) = ret;
+                    PUSH(instance);
+                } else {
+                    TOP_REPLACE(ret);
+                    PUSH(nullptr);
+                }
+
+                // If the fiber is suspended, execution resumes from the CALL instruction
+                cu_frame->instr_ptr += 4;
+
+                bool call_ok = CallFunction(fiber, &cu_frame, &cu_code, false);
+
+                if (GetFiberStatus() != FiberStatus::RUNNING)
+                    return nullptr;
+
+                if (!call_ok)
+                    break;
+
+                PREEMPTION_POINT();
+                JIT_POINT();
+                continue;
+            }
+            TARGET_OP(PSHC_POP)
+            {
+                ret = TOP();
+
+                if (!AR_TYPEOF(ret, type_chan_)) {
+                    ErrorFormat(kTypeError[0], kTypeError[2], type_chan_->name, AR_TYPE_QNAME(ret));
+                    break;
+                }
+
+                if (!ChanWrite((Chan *) ret, PEEK1())) {
+                    if (GetFiberStatus() != FiberStatus::RUNNING)
+                        return nullptr;
+
+                    break;
+                }
+
+                POP();
+                POP();
+                DISPATCH2();
+            }
             default:
-                ErrorFormat(kRuntimeError[0], "unknown opcode: 0x%X", *cu_frame->instr_ptr);
+                ErrorFormat(kRuntimeError[0], "unknown opcode: 0x%X", (unsigned char) LoadOpCode(cu_frame->instr_ptr));
         }
 
         if (IsPanickingFrame() && (uintptr_t) cu_frame->trap_ptr > 0) {
@@ -6,10 +6,21 @@
 #define ARGON_VM_AREVAL_H_
 
 #include <argon/vm/datatype/arobject.h>
+#include <argon/vm/datatype/integer.h>
 
 #include <argon/vm/fiber.h>
 
 namespace argon::vm {
+    /**
+     * @brief Compare two native integers as CMP does (fast path of the int specialized instructions).
+     *
+     * @param left Left operand.
+     * @param right Right operand.
+     * @param mode Comparison mode.
+     * @return Comparison result.
+     */
+    bool CompareInt(datatype::IntegerUnderlying left, datatype::IntegerUnderlying right, datatype::CompareMode mode);
+
     datatype::ArObject *Eval(Fiber *fiber);
 }
 
@@ -15,6 +15,7 @@ constexpr Config DefaultConfig = {
         nullptr,
         0,
 
+        false,
         true,
         false,
         false,
@@ -26,7 +27,12 @@ constexpr Config DefaultConfig = {
         -1,
         -1,
         -1,
-        2
+        2,
+        -1,
+        0,
+        0,
+        0,
+        0
 };
 const Config *argon::vm::kConfigDefault = &DefaultConfig;
 
@@ -37,13 +43,21 @@ static const char usage_line[] =
 
 static const char usage[] =
         "\nOptions and arguments:\n"
+        "--affinity     : pin OS threads to CPUs and prefer work stealing between VCores of the same NUMA node\n"
         "-c cmd         : program string\n"
+        "--decay ms     : return the pages of free memory arenas to the OS after ms milliseconds of inactivity "
+        "(0: disabled)\n"
         "-h, --help     : print this help message and exit\n"
+        "--hugepages    : reserve memory arenas in 2 MiB regions backed by transparent huge pages\n"
+        "--hugetlb      : like --hugepages, but use explicit huge pages (MAP_HUGETLB) when available\n"
         "-i             : start interactive mode after running script\n"
+        "--jit          : compile hot functions and loops to machine code (x86-64 Linux only)\n"
         "--nogc         : disable garbage collector\n"
         "-O             : set optimization level (0-3 -- 0: disabled, 3: hard)\n"
         "--pst          : print stacktrace\n"
         "-q             : don't print version messages on interactive startup\n"
+        "--schedstats ms: print scheduler statistics (JSON) to stderr every ms milliseconds (0: disabled)\n"
+        "--slice n      : preempt a fiber after n backward jumps/calls (0: disabled)\n"
         "-u             : force the stdout stream to be unbuffered\n"
         "-v, --version  : print Argon version and exit\n";
 
@@ -52,6 +66,13 @@ static const char usage_env[] =
         "ARGONUBUFFERED : it is equivalent to specifying the -u option.\n"
         "ARGONMAXVC     : value that controls the number of OS threads that can execute Argon code simultaneously.\n"
         "                 The default value of ARGONMAXVC is the number of CPUs visible at startup.\n"
+        "ARGONAFFINITY  : it is equivalent to specifying the --affinity option.\n"
+        "ARGONSLICE     : it is equivalent to specifying the --slice option.\n"
+        "ARGONSCHEDSTATS: it is equivalent to specifying the --schedstats option.\n"
+        "ARGONHUGEPAGES : it is equivalent to specifying the --hugepages option (--hugetlb if the value is 'tlb').\n"
+        "ARGONDECAY     : it is equivalent to specifying the --decay option.\n"
+        "ARGONJIT       : it is equivalent to specifying the --jit option, a number sets how many calls/backward\n"
+        "                 jumps make a code object hot (0: disabled).\n"
         "ARGONPATH      : augment the default search path for modules. One or more directories separated by "
         #ifdef _ARGON_PLATFORM_WIDNOWS
         "';' "
@@ -149,6 +170,31 @@ void ParseEnvs(Config *config) {
 
     if ((tmp = std::getenv(ARGON_EVAR_MAXVC)) != nullptr)
         config->max_vc = (int) strtol(tmp, nullptr, 10);
+
+    if (std::getenv(ARGON_EVAR_AFFINITY) != nullptr)
+        config->affinity = true;
+
+    if (config->time_slice < 0 && (tmp = std::getenv(ARGON_EVAR_SLICE)) != nullptr)
+        config->time_slice = (int) strtol(tmp, nullptr, 10);
+
+    if (config->schedstats == 0 && (tmp = std::getenv(ARGON_EVAR_SCHEDSTATS)) != nullptr)
+        config->schedstats = (int) strtol(tmp, nullptr, 10);
+
+    if (config->huge_pages == 0 && (tmp = std::getenv(ARGON_EVAR_HUGEPAGES)) != nullptr)
+        config->huge_pages = strcmp(tmp, "tlb") == 0 ? 2 : 1;
+
+    if (config->arena_decay == 0 && (tmp = std::getenv(ARGON_EVAR_DECAY)) != nullptr)
+        config->arena_decay = (int) strtol(tmp, nullptr, 10);
+
+    if (config->jit == 0 && (tmp = std::getenv(ARGON_EVAR_JIT)) != nullptr) {
+        char *end;
+
+        config->jit = (int) strtol(tmp, &end, 10);
+
+        // Any non-numeric value just enables the JIT (default threshold)
+        if (end == tmp)
+            config->jit = -1;
+    }
 }
 
 bool argon::vm::ConfigInit(Config *config, int argc, char **argv) {
@@ -157,7 +203,14 @@ bool argon::vm::ConfigInit(Config *config, int argc, char **argv) {
             {"version", false, 'v'},
 
             {"nogc",    false, 0},
-            {"pst",     false, 1}
+            {"pst",     false, 1},
+            {"slice",   true,  2},
+            {"affinity", false, 3},
+            {"schedstats", true, 4},
+            {"hugepages", false, 5},
+            {"hugetlb", false, 6},
+            {"decay", true, 7},
+            {"jit", false, 8}
     };
     ReadOpStatus status = {};
 
@@ -175,6 +228,53 @@ bool argon::vm::ConfigInit(Config *config, int argc, char **argv) {
             case 1: // --pst
                 config->stack_trace = true;
                 break;
+            case 2: { // --slice
+                auto slice = strtol(status.argument, nullptr, 10);
+
+                if (slice < 0) {
+                    fprintf(stderr, "invalid time slice. Expected a positive value, got: %s\n", status.argument);
+                    exit(EXIT_FAILURE);
+                }
+
+                config->time_slice = (int) slice;
+                break;
+            }
+            case 3: // --affinity
+                config->affinity = true;
+                break;
+            case 4: { // --schedstats
+                auto interval = strtol(status.argument, nullptr, 10);
+
+                if (interval < 0) {
+                    fprintf(stderr, "invalid schedstats interval. Expected a positive value, got: %s\n",
+                            status.argument);
+                    exit(EXIT_FAILURE);
+                }
+
+                config->schedstats = (int) interval;
+                break;
+            }
+            case 5: // --hugepages
+                config->huge_pages = 1;
+                break;
+            case 6: // --hugetlb
+                config->huge_pages = 2;
+                break;
+            case 7: { // --decay
+                auto decay = strtol(status.argument, nullptr, 10);
+
+                if (decay < 0) {
+                    fprintf(stderr, "invalid arena decay time. Expected a positive value, got: %s\n",
+                            status.argument);
+                    exit(EXIT_FAILURE);
+                }
+
+                config->arena_decay = (int) decay;
+                break;
+            }
+            case 8: // --jit
+                config->jit = -1;
+                break;
             case 'c':
                 config->cmd = status.argc_cur;
                 config->interactive = interactive;
@@ -9,12 +9,19 @@
 #define ARGON_EVAR_UNBUFFERED "ARGON_UNBUFFERED"
 #define ARGON_EVAR_STARTUP    "ARGON_STARTUP"
 #define ARGON_EVAR_MAXVC      "ARGON_MAXVC"
+#define ARGON_EVAR_AFFINITY   "ARGON_AFFINITY"
+#define ARGON_EVAR_SLICE      "ARGON_SLICE"
+#define ARGON_EVAR_SCHEDSTATS "ARGON_SCHEDSTATS"
+#define ARGON_EVAR_HUGEPAGES  "ARGON_HUGEPAGES"
+#define ARGON_EVAR_DECAY      "ARGON_DECAY"
+#define ARGON_EVAR_JIT        "ARGON_JIT"
 
 namespace argon::vm {
     struct Config {
         char **argv;
         int argc;
 
+        bool affinity;
         bool interactive;
         bool nogc;
         bool quiet;
@@ -28,6 +35,11 @@ namespace argon::vm {
         int fiber_ss;
         int fiber_pool;
         int optim_lvl;
+        int time_slice;
+        int schedstats;
+        int huge_pages;
+        int arena_decay;
+        int jit;
     };
 
     extern const Config *kConfigDefault;
@@ -18,6 +18,11 @@ using namespace argon::vm::datatype;
 
 static List *static_references = nullptr;
 
+static std::atomic<ArSize> type_version_tag = 0;
+
+constexpr ArSize kAttributeCacheBusy = ~((ArSize) 0);
+constexpr unsigned char kAttributeCacheMethod = 0x80;
+
 // Prototypes
 
 ArObject *MROSearch(const TypeInfo *type, ArObject *key, AttributeProperty *aprop);
@@ -290,6 +295,153 @@ const TypeInfo TypeTrait = {
         nullptr
 };
 
+bool IsMethodOf(const ArObject *object, const ArObject *attribute) {
+    const auto *func = (const Function *) attribute;
+    const auto *base = (const TypeInfo *) object;
+
+    if (AR_GET_TYPE(base) != type_type_)
+        base = AR_GET_TYPE(base);
+
+    return AR_TYPEOF(func, type_function_) && func->IsMethod() && TraitIsImplemented(base, func->base);
+}
+
+void AttributeCacheStore(AttributeCache *cache, ArSize tag, ArObject *value, unsigned char info) {
+    AttributeCacheEntry *entry = nullptr;
+
+    for (auto &cursor: cache->entries) {
+        auto current = cursor.tag.load(std::memory_order_relaxed);
+
+        if (current == tag)
+            return;
+
+        if (current == 0 && entry == nullptr)
+            entry = &cursor;
+    }
+
+    // All entries are in use (polymorphic call site), recycle one of them
+    if (entry == nullptr)
+        entry = cache->entries + (tag % kAttributeCacheWays);
+
+    auto current = entry->tag.load(std::memory_order_relaxed);
+    if (current == kAttributeCacheBusy
+        || !entry->tag.compare_exchange_strong(current, kAttributeCacheBusy, std::memory_order_relaxed))
+        return;
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    entry->value.store(value, std::memory_order_relaxed);
+    entry->info.store(info, std::memory_order_relaxed);
+
+    entry->tag.store(tag, std::memory_order_release);
+}
+
+void AttributeCacheFill(AttributeCache *cache, const ArObject *object, ArSize tag) {
+    const auto *type = AR_GET_TYPE(object);
+    ArObject **ns = nullptr;
+    ArObject *value = nullptr;
+
+    AttributeProperty aprop{};
+    AttributeCacheKind kind;
+
+    // Only objects that rely on the default attribute getter can be cached
+    if (AR_HAVE_OBJECT_BEHAVIOUR(object)) {
+        if (AR_SLOT_OBJECT(object)->get_attr != nullptr && AR_SLOT_OBJECT(object)->get_attr != type_get_attr)
+            return;
+
+        ns = AR_GET_NSOFFSET(object);
+    }
+
+    if (ns != nullptr && (value = NamespaceLookup((Namespace *) *ns, cache->key, &aprop)) != nullptr) {
+        Release(value);
+
+        if (aprop.IsPublic())
+            AttributeCacheStore(cache, tag, nullptr, (unsigned char) AttributeCacheKind::FIELD);
+
+        return;
+    }
+
+    if (type->tp_map != nullptr)
+        value = NamespaceLookup((Namespace *) type->tp_map, cache->key, &aprop);
+
+    if (value == nullptr && (value = MROSearch(type, cache->key, &aprop)) == nullptr)
+        return;
+
+    /*
+     * The value is stored as a borrowed reference, this is safe only for constant attributes because
+     * they cannot be replaced once the type has been defined.
+     */
+    if (!aprop.IsPublic() || !aprop.IsConstant() || aprop.IsWeak()) {
+        Release(value);
+        return;
+    }
+
+    kind = AR_TYPEOF(value, type_native_wrapper_) ? AttributeCacheKind::WRAPPER : AttributeCacheKind::VALUE;
+
+    auto info = (unsigned char) kind;
+    if (kind == AttributeCacheKind::VALUE && type != type_type_ && IsMethodOf(object, value))
+        info |= kAttributeCacheMethod;
+
+    AttributeCacheStore(cache, tag, value, info);
+
+    Release(value);
+}
+
+ArObject *AttributeCacheLookup(const ArObject *object, AttributeCache *cache, ArSize tag, bool *is_method) {
+    ArObject *value = nullptr;
+    unsigned char info = 0;
+
+    for (auto &entry: cache->entries) {
+        if (entry.tag.load(std::memory_order_acquire) != tag)
+            continue;
+
+        value = entry.value.load(std::memory_order_relaxed);
+        info = entry.info.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        // Entry was overwritten while it was being read
+        if (entry.tag.load(std::memory_order_relaxed) != tag)
+            return nullptr;
+
+        break;
+    }
+
+    switch ((AttributeCacheKind) (info & ~kAttributeCacheMethod)) {
+        case AttributeCacheKind::FIELD: {
+            AttributeProperty aprop{};
+
+            value = NamespaceLookup(*((Namespace **) AR_GET_NSOFFSET(object)), cache->key, &aprop);
+            if (value != nullptr && !aprop.IsPublic()) {
+                Release(value);
+                return nullptr;
+            }
+
+            if (value != nullptr && is_method != nullptr)
+                *is_method = IsMethodOf(object, value);
+
+            return value;
+        }
+        case AttributeCacheKind::VALUE:
+            if (is_method != nullptr) {
+                *is_method = (info & kAttributeCacheMethod) == kAttributeCacheMethod;
+
+                if (AR_GET_TYPE(object) == type_type_)
+                    *is_method = IsMethodOf(object, value);
+            }
+
+            return IncRef(value);
+        case AttributeCacheKind::WRAPPER:
+            value = NativeWrapperGet((NativeWrapper *) value, object);
+
+            if (value != nullptr && is_method != nullptr)
+                *is_method = IsMethodOf(object, value);
+
+            return value;
+        default:
+            return nullptr;
+    }
+}
+
 ArObject *argon::vm::datatype::AttributeLoad(const ArObject *object, ArObject *key, bool static_attr) {
     AttributeGetter aload = type_type_->object->get_attr;
 
@@ -299,6 +451,22 @@ ArObject *argon::vm::datatype::AttributeLoad(const ArObject *object, ArObject *k
     return aload(object, key, static_attr);
 }
 
+ArObject *argon::vm::datatype::AttributeLoadCached(const ArObject *object, AttributeCache *cache) {
+    auto tag = TypeGetVersionTag(AR_GET_TYPE(object));
+    ArObject *ret;
+
+    if (tag != 0 && (ret = AttributeCacheLookup(object, cache, tag, nullptr)) != nullptr)
+        return ret;
+
+    if (argon::vm::IsPanicking())
+        return nullptr;
+
+    if ((ret = AttributeLoad(object, cache->key, false)) != nullptr && tag != 0)
+        AttributeCacheFill(cache, object, tag);
+
+    return ret;
+}
+
 ArObject *argon::vm::datatype::AttributeLoadMethod(const ArObject *object, ArObject *key, bool *is_method) {
     ArObject *aload;
 
@@ -307,16 +475,28 @@ ArObject *argon::vm::datatype::AttributeLoadMethod(const ArObject *object, ArObj
     if ((aload = AttributeLoad(object, key, false)) == nullptr)
         return nullptr;
 
-    const auto *func = (Function *) aload;
-    const auto *base = (TypeInfo *) object;
+    *is_method = IsMethodOf(object, aload);
 
-    if (AR_GET_TYPE(base) != type_type_)
-        base = AR_GET_TYPE(base);
+    return aload;
+}
 
-    if (AR_TYPEOF(func, type_function_) && func->IsMethod() && TraitIsImplemented(base, func->base))
-        *is_method = true;
+ArObject *argon::vm::datatype::AttributeLoadMethodCached(const ArObject *object, AttributeCache *cache,
+                                                         bool *is_method) {
+    auto tag = TypeGetVersionTag(AR_GET_TYPE(object));
+    ArObject *ret;
 
-    return aload;
+    *is_method = false;
+
+    if (tag != 0 && (ret = AttributeCacheLookup(object, cache, tag, is_method)) != nullptr)
+        return ret;
+
+    if (argon::vm::IsPanicking())
+        return nullptr;
+
+    if ((ret = AttributeLoadMethod(object, cache->key, is_method)) != nullptr && tag != 0)
+        AttributeCacheFill(cache, object, tag);
+
+    return ret;
 }
 
 ArObject *argon::vm::datatype::AttributeLoadMethod(const ArObject *object, const char *key) {
@@ -626,6 +806,8 @@ ArObject *argon::vm::datatype::TypeNew(const TypeInfo *type, const char *name, c
     AR_UNSAFE_GET_RC(ret) = (ArSize) memory::RCType::INLINE;
     AR_GET_TYPE(ret) = IncRef((TypeInfo *) type_type_);
 
+    ret->version_tag = 0;
+
     if ((ret->name = (char *) memory::Alloc(name_len + 1)) == nullptr) {
         memory::Free(ret);
         return nullptr;
@@ -1150,6 +1332,8 @@ bool argon::vm::datatype::TypeInit(TypeInfo *type, ArObject *auxiliary, TypeInfo
 
     CheckMethodsOverride(type);
 
+    TypeModified(type);
+
     *((TypeInfoFlags *) &type->flags) = type->flags | TypeInfoFlags::INITIALIZED;
 
     return true;
@@ -1192,6 +1376,21 @@ bool argon::vm::datatype::TypeOF(const ArObject *object, const TypeInfo *type) {
     return TraitIsImplemented(AR_GET_TYPE(object), type);
 }
 
+ArSize argon::vm::datatype::TypeGetVersionTag(const TypeInfo *type) {
+    auto *tag = &((TypeInfo *) type)->version_tag;
+    auto current = tag->load(std::memory_order_acquire);
+
+    if (current != 0 || ENUMBITMASK_ISFALSE(type->flags, TypeInfoFlags::INITIALIZED))
+        return current;
+
+    auto next = type_version_tag.fetch_add(1, std::memory_order_relaxed) + 1;
+
+    if (!tag->compare_exchange_strong(current, next, std::memory_order_acq_rel))
+        return current;
+
+    return next;
+}
+
 int argon::vm::datatype::MonitorAcquire(ArObject *object) {
     auto *monitor = AR_GET_MON(object).load(std::memory_order_consume);
 
@@ -1347,6 +1546,10 @@ void argon::vm::datatype::RecursionUntrack(ArObject *object) {
     ListRemove(*ref, ((ArSSize) (*ref)->length) - 1);
 }
 
+void argon::vm::datatype::TypeModified(TypeInfo *type) {
+    type->version_tag.store(0, std::memory_order_release);
+}
+
 // RefStore
 
 RefStore::~RefStore() {
@@ -10,16 +10,73 @@
 #include <argon/util/macros.h>
 
 #include <argon/vm/memory/gc.h>
+#include <argon/vm/memory/heapprof.h>
 
 #include <argon/vm/datatype/objectdef.h>
 
 namespace argon::vm::datatype {
     _ARGONAPI extern const TypeInfo *type_type_;
 
+    /// Number of receiver types that can be tracked by a single attribute cache.
+    constexpr unsigned short kAttributeCacheWays = 4;
+
+    enum class AttributeCacheKind : unsigned char {
+        EMPTY,
+        FIELD,
+        VALUE,
+        WRAPPER
+    };
+
+    struct AttributeCacheEntry {
+        /// Version tag of the receiver type (see TypeGetVersionTag).
+        std::atomic<ArSize> tag;
+
+        /// Borrowed reference to the resolved attribute (VALUE) or to its NativeWrapper (WRAPPER).
+        std::atomic<ArObject *> value;
+
+        /// AttributeCacheKind in the low bits, is_method flag in the high bit.
+        std::atomic<unsigned char> info;
+    };
+
+    /**
+     * @brief Inline cache associated with a single LDATTR/LDMETH instruction.
+     *
+     * Entries are keyed on the version tag of the receiver type, the cached values are borrowed from the type
+     * namespace (or from one of its MRO ancestors) that are only populated while the type is being defined.
+     */
+    struct AttributeCache {
+        /// Attribute name (borrowed from Code::statics).
+        ArObject *key;
+
+        /// Index of the attribute name in Code::statics.
+        unsigned int index;
+
+        AttributeCacheEntry entries[kAttributeCacheWays];
+    };
+
     ArObject *AttributeLoad(const ArObject *object, ArObject *key, bool static_attr);
 
+    /**
+     * @brief Like AttributeLoad, but uses (and updates) the inline cache associated with an LDATTR instruction.
+     *
+     * @param object Pointer to the instance.
+     * @param cache Pointer to the inline cache.
+     * @return A pointer to the attribute on success, otherwise nullptr (panic state will be set).
+     */
+    ArObject *AttributeLoadCached(const ArObject *object, AttributeCache *cache);
+
     ArObject *AttributeLoadMethod(const ArObject *object, ArObject *key, bool *is_method);
 
+    /**
+     * @brief Like AttributeLoadMethod, but uses (and updates) the inline cache associated with an LDMETH instruction.
+     *
+     * @param object Pointer to the instance.
+     * @param cache Pointer to the inline cache.
+     * @param is_method Pointer to a bool variable that receives true if the attribute is a method of object.
+     * @return A pointer to the attribute on success, otherwise nullptr (panic state will be set).
+     */
+    ArObject *AttributeLoadMethodCached(const ArObject *object, AttributeCache *cache, bool *is_method);
+
     ArObject *AttributeLoadMethod(const ArObject *object, const char *key);
 
     ArObject *ComputeMRO(TypeInfo *type, TypeInfo **bases, unsigned int length);
@@ -72,6 +129,17 @@ namespace argon::vm::datatype {
 
     bool IsTrue(const ArObject *object);
 
+    /**
+     * @brief Returns the version tag of a type, assigning a new one if necessary.
+     *
+     * Tags are never reused, so an attribute cache entry keyed on a tag remains valid as long as the type
+     * is not modified (see TypeModified).
+     *
+     * @param type Pointer to the type.
+     * @return Version tag, or 0 if the type cannot be cached (e.g. not yet initialized).
+     */
+    ArSize TypeGetVersionTag(const TypeInfo *type);
+
     bool TypeInit(TypeInfo *type, ArObject *auxiliary, TypeInfo **bases, unsigned int length);
 
     inline bool TypeInit(TypeInfo *type, ArObject *auxiliary) {
@@ -82,6 +150,17 @@ namespace argon::vm::datatype {
 
     bool TypeOF(const ArObject *object, const TypeInfo *type);
 
+    /**
+     * @brief Invalidates all attribute cache entries that refer to the type.
+     *
+     * Types are immutable once their definition is complete (static attributes are constants and cannot be
+     * reassigned), so this is only needed while a type is being defined (TypeInit, TSTORE). At that point the type
+     * cannot be a base of any other type yet, hence subtypes are never invalidated.
+     *
+     * @param type Pointer to the modified type.
+     */
+    void TypeModified(TypeInfo *type);
+
     int MonitorAcquire(ArObject *object);
 
     int RecursionTrack(ArObject *object);
@@ -104,6 +183,8 @@ namespace argon::vm::datatype {
         AR_GET_TYPE(ret) = type;
         AR_UNSAFE_GET_MON(ret) = nullptr;
 
+        memory::HeapProfTrackObject(ret, ret);
+
         return (T *) ret;
     }
 
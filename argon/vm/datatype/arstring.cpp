@@ -196,7 +196,7 @@ ARGON_METHOD(str_expandtabs, expandtabs,
              "- KWParameters:\n"
              "  - tabsize: Size of the tab; default step is 4.\n"
              "- Returns: A copy of the string where all tab characters were replaced by spaces.\n",
-             nullptr, false, true) {
+             nullptr, false, kFunctionKWArgsView) {
     IntegerUnderlying tabsize;
 
     if (!KParamLookupInt((Dict *) kwargs, "tabsize", &tabsize, 4))
@@ -312,7 +312,7 @@ ARGON_METHOD(str_ltrim, ltrim,
              "- KWParameters:\n"
              "  - chars: A set of characters to remove as leading characters.\n"
              "- Returns: New string without whitespace.\n",
-             nullptr, false, true) {
+             nullptr, false, kFunctionKWArgsView) {
     return trim((String *) _self, (Dict *) kwargs, true, false);
 }
 
@@ -350,7 +350,7 @@ ARGON_METHOD(str_replace, replace,
              "  - count: Number specifying how many occurrences of the old value you want to replace. "
              "To replace all occurrence use -1.\n"
              "- Returns: String where a specified value is replaced.\n",
-             "s: old, s: new", false, true) {
+             "s: old, s: new", false, kFunctionKWArgsView) {
     IntegerUnderlying count;
 
     if (!KParamLookupInt((Dict *) kwargs, "count", &count, -1))
@@ -474,7 +474,7 @@ ARGON_METHOD(str_split, split,
              "- KWParameters:\n"
              "  - splits: Specifies how many splits to do.\n"
              "- Returns: New list of string.\n",
-             "sn: pattern", false, true) {
+             "sn: pattern", false, kFunctionKWArgsView) {
     const unsigned char *pattern = nullptr;
     ArSize plen = 0;
 
@@ -507,7 +507,7 @@ ARGON_METHOD(str_splitlines, splitlines,
              "- KWParameters:\n"
              "  - splits: Specifies how many splits to do.\n"
              "- Returns: New list of string.\n",
-             nullptr, false, true) {
+             nullptr, false, kFunctionKWArgsView) {
     IntegerUnderlying maxsplit;
 
     if (!KParamLookupInt((Dict *) kwargs, "splits", &maxsplit, -1))
@@ -522,7 +522,7 @@ ARGON_METHOD(str_splitws, splitws,
              "- KWParameters:\n"
              "  - splits: Specifies how many splits to do.\n"
              "- Returns: New list of string.\n",
-             nullptr, false, true) {
+             nullptr, false, kFunctionKWArgsView) {
     IntegerUnderlying maxsplit;
 
     if (!KParamLookupInt((Dict *) kwargs, "splits", &maxsplit, -1))
@@ -561,7 +561,7 @@ ARGON_METHOD(str_rtrim, rtrim,
              "- KWParameters:\n"
              "  - chars: A set of characters to remove as trailing characters.\n"
              "- Returns: New string without whitespace.\n",
-             nullptr, false, true) {
+             nullptr, false, kFunctionKWArgsView) {
     return trim((String *) _self, (Dict *) kwargs, false, true);
 }
 
@@ -571,7 +571,7 @@ ARGON_METHOD(str_trim, trim,
              "- KWParameters:\n"
              "  - chars: A set of characters to remove as leading/trailing characters.\n"
              "- Returns: New string without whitespace.\n",
-             nullptr, false, true) {
+             nullptr, false, kFunctionKWArgsView) {
     return trim((String *) _self, (Dict *) kwargs, true, true);
 }
 
@@ -32,7 +32,7 @@ ArObject *trim(Bytes *self, Dict *kwargs, bool left, bool right) {
     Bytes *tmp = nullptr;
 
     if (kwargs != nullptr) {
-        if (!DictLookup(kwargs, "chars", (ArObject **) &tmp))
+        if (!KParamLookup(kwargs, "chars", nullptr, (ArObject **) &tmp, nullptr, false))
             return nullptr;
 
         if (tmp != nullptr) {
@@ -521,7 +521,7 @@ ARGON_METHOD(bytes_ltrim, ltrim,
              "- KWParameters:\n"
              "  - chars: A set of characters to remove as leading characters.\n"
              "- Returns: New bytes string without whitespace.\n",
-             nullptr, false, true) {
+             nullptr, false, kFunctionKWArgsView) {
     return trim((Bytes *) _self, (Dict *) kwargs, true, false);
 }
 
@@ -535,7 +535,7 @@ ARGON_METHOD(bytes_replace, replace,
              "  - count: Number specifying how many occurrences of the old value you want to replace. "
              "To replace all occurrence use -1.\n"
              "- Returns: Bytes string where a specified value is replaced.\n",
-             "x: old, x: new", false, true) {
+             "x: old, x: new", false, kFunctionKWArgsView) {
     IntegerUnderlying count;
 
     if (!KParamLookupInt((Dict *) kwargs, "count", &count, -1))
@@ -676,7 +676,7 @@ ARGON_METHOD(bytes_rtrim, rtrim,
              "- KWParameters:\n"
              "  - chars: A set of characters to remove as trailing characters.\n"
              "- Returns: New bytes string without whitespace.\n",
-             nullptr, false, true) {
+             nullptr, false, kFunctionKWArgsView) {
     return trim((Bytes *) _self, (Dict *) kwargs, false, true);
 }
 
@@ -688,7 +688,7 @@ ARGON_METHOD(bytes_split, split,
              "- KWParameters:\n"
              "  - splits: Specifies how many splits to do.\n"
              "- Returns: New list of bytes string.\n",
-             ": pattern", false, true) {
+             ": pattern", false, kFunctionKWArgsView) {
     ArBuffer buffer{};
     const unsigned char *pattern = nullptr;
     ArObject *ret;
@@ -742,7 +742,7 @@ ARGON_METHOD(bytes_splitlines, splitlines,
              "- KWParameters:\n"
              "  - splits: Specifies how many splits to do.\n"
              "- Returns: New list of bytes string.\n",
-             nullptr, false, true) {
+             nullptr, false, kFunctionKWArgsView) {
     IntegerUnderlying maxsplit;
 
     if (!KParamLookupInt((Dict *) kwargs, "splits", &maxsplit, -1))
@@ -763,7 +763,7 @@ ARGON_METHOD(bytes_splitws, splitws,
              "- KWParameters:\n"
              "  - splits: Specifies how many splits to do.\n"
              "- Returns: New list of bytes string.\n",
-             nullptr, false, true) {
+             nullptr, false, kFunctionKWArgsView) {
     IntegerUnderlying maxsplit;
 
     if (!KParamLookupInt((Dict *) kwargs, "splits", &maxsplit, -1))
@@ -868,7 +868,7 @@ ARGON_METHOD(bytes_trim, trim,
              "- KWParameters:\n"
              "  - chars: A set of characters to remove as leading/trailing characters.\n"
              "- Returns: New bytes string without whitespace.\n",
-             nullptr, false, true) {
+             nullptr, false, kFunctionKWArgsView) {
     return trim((Bytes *) _self, (Dict *) kwargs, true, true);
 }
 
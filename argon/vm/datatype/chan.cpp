@@ -25,7 +25,7 @@ ARGON_FUNCTION(chan_chan, Chan,
                "  - backlog: Set the size of the backlog.\n"
                "  - defval: Sets the value to be returned when a read operation is performed on a closed channel."
                "- returns: New Chan object.\n",
-               nullptr, false, true) {
+               nullptr, false, kFunctionKWArgsView) {
     ArObject *defval;
 
     IntegerUnderlying backlog;
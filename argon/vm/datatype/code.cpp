@@ -2,6 +2,9 @@
 //
 // Licensed under the Apache License v2.0
 
+#include <argon/vm/jit.h>
+#include <argon/vm/runtime.h>
+
 #include <argon/vm/datatype/boolean.h>
 #include <argon/vm/datatype/bytes.h>
 
@@ -9,6 +12,7 @@
 
 #include <argon/vm/datatype/code.h>
 
+using namespace argon::vm;
 using namespace argon::vm::datatype;
 
 unsigned int Code::GetLineMapping(ArSize offset) const {
@@ -25,8 +29,119 @@ unsigned int Code::GetLineMapping(ArSize offset) const {
     return mapping_line;
 }
 
+static bool IsAttributeLoad(argon::vm::OpCode op) {
+    return op == argon::vm::OpCode::LDATTR || op == argon::vm::OpCode::LDMETH || op == argon::vm::OpCode::LDMETH_CALL;
+}
+
+void Code::InitAttributeCache() {
+    AttributeCache *cache;
+    unsigned short *map;
+    unsigned int count = 0;
+
+    for (const auto *cursor = this->instr; cursor < this->instr_end; cursor += OpCodeOffset[*cursor]) {
+        if (!IsAttributeLoad((OpCode) *cursor))
+            continue;
+
+        // Leave these instructions uncached, the error will be reported by the evaluation loop
+        if (this->statics == nullptr || I32Arg(cursor) >= this->statics->length)
+            return;
+
+        count++;
+    }
+
+    // Cache indexes must fit in the offset map
+    if (count == 0 || count >= 0xFFFF)
+        return;
+
+    // Caches are optional, on allocation failure the evaluation loop falls back to the uncached lookup
+    if ((cache = (AttributeCache *) memory::Calloc(sizeof(AttributeCache) * count)) == nullptr) {
+        DiscardLastPanic();
+        return;
+    }
+
+    if ((map = (unsigned short *) memory::Calloc(sizeof(unsigned short) * this->instr_sz)) == nullptr) {
+        memory::Free(cache);
+
+        DiscardLastPanic();
+        return;
+    }
+
+    this->attr_cache = cache;
+    this->attr_cache_map = map;
+    this->attr_cache_sz = count;
+
+    for (const auto *cursor = this->instr; cursor < this->instr_end; cursor += OpCodeOffset[*cursor]) {
+        if (!IsAttributeLoad((OpCode) *cursor))
+            continue;
+
+        cache->index = I32Arg(cursor);
+        cache->key = this->statics->objects[cache->index];
+
+        cache++;
+
+        map[cursor - this->instr] = (unsigned short) (cache - this->attr_cache);
+    }
+}
+
+void Code::InitGlobalCache() {
+    if (this->names == nullptr || this->names->length == 0)
+        return;
+
+    this->gbl_cache = (GlobalCache *) memory::Calloc(sizeof(GlobalCache) * this->names->length);
+    if (this->gbl_cache == nullptr)
+        DiscardLastPanic();
+}
+
+void Code::InitHash() {
+    // Computed before the code runs for the first time, quickened opcodes never affect the hash
+    this->hash = HashBytes(this->instr, this->instr_sz);
+    this->hash = AR_NORMALIZE_HASH(this->hash);
+}
+
+void Code::QuickenMiss(const unsigned char *ip) {
+    auto *misses = this->qk_misses.load(std::memory_order_acquire);
+
+    if (misses == nullptr) {
+        // The counters are optional, without them the instruction can be quickened again
+        if ((misses = (std::atomic<unsigned char> *) memory::Calloc(this->instr_sz)) == nullptr) {
+            DiscardLastPanic();
+            return;
+        }
+
+        std::atomic<unsigned char> *expected = nullptr;
+        if (!this->qk_misses.compare_exchange_strong(expected, misses, std::memory_order_acq_rel)) {
+            memory::Free(misses);
+            misses = expected;
+        }
+    }
+
+    auto *counter = misses + (ip - this->instr);
+    auto current = counter->load(std::memory_order_relaxed);
+
+    if (current < kQuickenMaxMisses)
+        counter->store(current + 1, std::memory_order_relaxed);
+}
+
 ArObject *code_member_get_instr(const Code *self) {
-    return (ArObject *) BytesNew(self->instr, self->instr_end - self->instr, true);
+    auto *bytes = BytesNew(self->instr_sz, true, false, true);
+
+    if (bytes == nullptr)
+        return nullptr;
+
+    // Report the bytecode as emitted by the compiler, without the quickened opcodes
+    auto *buffer = bytes->view.buffer;
+    for (const auto *cursor = self->instr; cursor < self->instr_end;) {
+        auto op = GenericOpCode(LoadOpCode(cursor));
+        auto length = OpCodeOffset[(unsigned char) op];
+
+        *buffer = (unsigned char) op;
+        argon::vm::memory::MemoryCopy(buffer + 1, cursor + 1, length - 1);
+
+        buffer += length;
+        cursor += length;
+    }
+
+    return (ArObject *) bytes;
 }
 
 const MemberDef code_members[] = {
@@ -65,8 +180,22 @@ ArObject *code_compare(const Code *self, const ArObject *other, CompareMode mode
     if (!AR_SAME_TYPE(self, other) || mode != CompareMode::EQ)
         return nullptr;
 
-    if (self->instr_sz == ((const Code *) other)->instr_sz)
-        equal = argon::vm::memory::MemoryCompare(self->instr, ((const Code *) other)->instr, self->instr_sz) == 0;
+    if (self->instr_sz != ((const Code *) other)->instr_sz)
+        return BoolToArBool(false);
+
+    const auto *o_cursor = ((const Code *) other)->instr;
+
+    equal = true;
+    for (const auto *cursor = self->instr; equal && cursor < self->instr_end;) {
+        auto op = GenericOpCode(LoadOpCode(cursor));
+        auto length = OpCodeOffset[(unsigned char) op];
+
+        equal = op == GenericOpCode(LoadOpCode(o_cursor))
+                && argon::vm::memory::MemoryCompare(cursor + 1, o_cursor + 1, length - 1) == 0;
+
+        cursor += length;
+        o_cursor += length;
+    }
 
     return BoolToArBool(equal);
 }
@@ -81,6 +210,23 @@ ArSize code_hash(Code *self) {
 }
 
 bool code_dtor(Code *self) {
+    if (self->gbl_cache != nullptr) {
+        for (ArSize i = 0; i < self->names->length; i++) {
+            auto *cache = self->gbl_cache + i;
+
+            Release(cache->value.load(std::memory_order_relaxed));
+
+            while (cache->retired != nullptr) {
+                auto *next = cache->retired->next;
+
+                Release(cache->retired->value);
+                argon::vm::memory::Free(cache->retired);
+
+                cache->retired = next;
+            }
+        }
+    }
+
     Release(self->name);
     Release(self->qname);
     Release(self->doc);
@@ -91,6 +237,12 @@ bool code_dtor(Code *self) {
     Release(self->enclosed);
 
     argon::vm::memory::Free((void *) self->instr);
+    argon::vm::memory::Free(self->attr_cache);
+    argon::vm::memory::Free(self->attr_cache_map);
+    argon::vm::memory::Free(self->gbl_cache);
+    argon::vm::memory::Free(self->qk_misses.load(std::memory_order_relaxed));
+
+    argon::vm::jit::Release(self);
 
     return true;
 }
@@ -134,6 +286,15 @@ Code *argon::vm::datatype::CodeNew(List *statics, List *names, List *lnames, Lis
         code->instr_end = nullptr;
         code->linfo = nullptr;
 
+        code->attr_cache = nullptr;
+        code->attr_cache_map = nullptr;
+        code->attr_cache_sz = 0;
+        code->gbl_cache = nullptr;
+        code->qk_misses = nullptr;
+        code->jit = nullptr;
+        code->jit_hotness = 0;
+        code->jit_state = kJITCold;
+
         code->instr_sz = 0;
         code->sstack_sz = 0;
         code->stack_sz = 0;
@@ -193,6 +354,15 @@ Code *argon::vm::datatype::CodeWrapFnCall(unsigned short argc, OpCodeCallMode mo
         code->linfo = nullptr;
         code->linfo_sz = 0;
 
+        code->attr_cache = nullptr;
+        code->attr_cache_map = nullptr;
+        code->attr_cache_sz = 0;
+        code->gbl_cache = nullptr;
+        code->qk_misses = nullptr;
+        code->jit = nullptr;
+        code->jit_hotness = 0;
+        code->jit_state = kJITCold;
+
         code->name = nullptr;
         code->qname = nullptr;
         code->doc = nullptr;
@@ -5,6 +5,8 @@
 #ifndef ARGON_VM_DATATYPE_CODE_H_
 #define ARGON_VM_DATATYPE_CODE_H_
 
+#include <cstdint>
+
 #include <argon/vm/opcode.h>
 
 #include <argon/vm/datatype/arobject.h>
@@ -12,7 +14,49 @@
 #include <argon/vm/datatype/list.h>
 #include <argon/vm/datatype/tuple.h>
 
+namespace argon::vm::jit {
+    struct JITCode;
+}
+
 namespace argon::vm::datatype {
+    /// Value replaced by a refill of a GlobalCache, a concurrent reader may still be using it.
+    struct GlobalCacheRetired {
+        GlobalCacheRetired *next;
+
+        ArObject *value;
+    };
+
+    /// Refills after which a GlobalCache stops following a symbol that keeps being rebound.
+    constexpr unsigned char kGlobalCacheMaxRefills = 8;
+
+    /**
+     * @brief Cache used by LDGBL, it is valid as long as both globals and builtins namespaces are unchanged.
+     */
+    struct GlobalCache {
+        /// Version of the globals namespace when the cache was filled (0 means empty).
+        std::atomic<std::uint64_t> globals_version;
+
+        /// Version of the builtins namespace when the cache was filled.
+        std::atomic<std::uint64_t> builtins_version;
+
+        /// Strong reference to a constant symbol.
+        std::atomic<ArObject *> value;
+
+        /// Previous values (strong references), they are released together with the Code object.
+        GlobalCacheRetired *retired;
+
+        /// Number of times the value was replaced.
+        unsigned char refills;
+    };
+
+    /// Type guard failures after which a quickened instruction is pinned to its generic form.
+    constexpr unsigned char kQuickenMaxMisses = 4;
+
+    constexpr unsigned char kJITCold = 0;
+    constexpr unsigned char kJITCompiling = 1;
+    constexpr unsigned char kJITCompiled = 2;
+    constexpr unsigned char kJITFailed = 3;
+
     struct Code {
         AROBJ_HEAD;
 
@@ -64,9 +108,36 @@ namespace argon::vm::datatype {
         /// Hash value computed on buffer instr.
         ArSize hash;
 
+        /// Inline caches used by LDATTR/LDMETH (one for each instruction, see SetBytecode).
+        AttributeCache *attr_cache;
+
+        /// Maps an instruction offset to its AttributeCache (index + 1, 0 means no cache).
+        unsigned short *attr_cache_map;
+
+        /// Length of attr_cache.
+        unsigned int attr_cache_sz;
+
+        /// Caches used by LDGBL (one for each entry in names).
+        GlobalCache *gbl_cache;
+
+        /// Type guard failures of quickened instructions (indexed by offset, allocated on the first failure).
+        std::atomic<std::atomic<unsigned char> *> qk_misses;
+
+        /// Machine code generated by the baseline JIT (see jit::Enter), valid once jit_state is kJITCompiled.
+        jit::JITCode *jit;
+
+        /// Calls and backward jumps counted by the JIT to decide when to compile this code.
+        unsigned int jit_hotness;
+
+        /// JIT compilation state (kJITCold, kJITCompiling, kJITCompiled or kJITFailed).
+        std::atomic<unsigned char> jit_state;
+
         /**
          * @brief Set bytecode to code object.
          *
+         * If the attribute caches can be allocated, every LDATTR/LDMETH instruction gets its own AttributeCache.
+         * The bytecode is left untouched, caches are retrieved by instruction offset (see GetAttributeCache).
+         *
          * @param co_instr Buffer containing the bytecode of the Argon VM (give buffer ownership to the Code object).
          * @param co_instr_sz Length of instr buffer.
          * @param co_stack_sz Length of evaluation stack.
@@ -85,6 +156,10 @@ namespace argon::vm::datatype {
             this->sstack_sz = co_sstack_sz;
             this->stack_sz = co_stack_sz;
 
+            this->InitAttributeCache();
+            this->InitGlobalCache();
+            this->InitHash();
+
             return this;
         }
 
@@ -123,7 +198,47 @@ namespace argon::vm::datatype {
             return this;
         }
 
+        /**
+         * @brief Returns the AttributeCache associated with an LDATTR/LDMETH instruction.
+         *
+         * @param ip Pointer to the instruction.
+         * @return Pointer to the cache, or nullptr if the instruction has no cache.
+         */
+        AttributeCache *GetAttributeCache(const unsigned char *ip) const {
+            unsigned short index;
+
+            if (this->attr_cache_map == nullptr || (index = this->attr_cache_map[ip - this->instr]) == 0)
+                return nullptr;
+
+            return this->attr_cache + (index - 1);
+        }
+
+        /**
+         * @brief Checks if the instruction can be replaced by its specialized form.
+         *
+         * @param ip Pointer to the instruction.
+         * @return False if the specialized form has been rejected too many times (see QuickenMiss).
+         */
+        bool CanQuicken(const unsigned char *ip) const {
+            const auto *misses = this->qk_misses.load(std::memory_order_acquire);
+
+            return misses == nullptr || misses[ip - this->instr].load(std::memory_order_relaxed) < kQuickenMaxMisses;
+        }
+
         unsigned int GetLineMapping(ArSize offset) const;
+
+        void InitAttributeCache();
+
+        void InitGlobalCache();
+
+        void InitHash();
+
+        /**
+         * @brief Records a type guard failure of a quickened instruction.
+         *
+         * @param ip Pointer to the instruction.
+         */
+        void QuickenMiss(const unsigned char *ip);
     };
 
     _ARGONAPI extern const TypeInfo *type_code_;
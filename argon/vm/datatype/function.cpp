@@ -160,31 +160,40 @@ TypeInfo FunctionType = {
 };
 const TypeInfo *argon::vm::datatype::type_function_ = &FunctionType;
 
+bool FunctionCheckParam(const Param *param, const ArObject *arg, int index) {
+    if (param->expected != nullptr) {
+        if (AR_TYPEOF(arg, param->expected))
+            return true;
+    } else {
+        for (auto cursor = param->types; *cursor != nullptr; cursor++) {
+            if (AR_TYPEOF(arg, *cursor))
+                return true;
+        }
+    }
+
+    ErrorFormat(kTypeError[0],
+                "unexpected '%s' type for '%s' parameter(%d)",
+                AR_TYPE_NAME(arg), param->name, index);
+
+    return false;
+}
+
 bool FunctionCheckParams(const PCheck *pcheck, ArObject **args, ArSize count) {
     if (pcheck == nullptr)
         return true;
 
-    for (int i = 0; i < pcheck->count; i++) {
-        const auto *param = pcheck->params[i];
-        const auto *arg = args[i];
-        bool ok = false;
-
-        if (*param->types == nullptr)
-            continue;
+    // Parameters without a type constraint are skipped using the precompiled bitmap
+    auto typed = pcheck->typed;
+    for (int i = 0; typed != 0; i++, typed >>= 1) {
+        if ((typed & 1) != 0 && !FunctionCheckParam(pcheck->params[i], args[i], i))
+            return false;
+    }
 
-        for (auto cursor = param->types; *cursor != nullptr; cursor++) {
-            if (AR_TYPEOF(arg, *cursor)) {
-                ok = true;
-                break;
-            }
-        }
+    for (int i = kPCheckMaskBits; i < pcheck->count; i++) {
+        const auto *param = pcheck->params[i];
 
-        if (!ok) {
-            ErrorFormat(kTypeError[0],
-                        "unexpected '%s' type for '%s' parameter(%d)",
-                        AR_TYPE_NAME(arg), param->name, i);
+        if (*param->types != nullptr && !FunctionCheckParam(param, args[i], i))
             return false;
-        }
     }
 
     return true;
@@ -210,6 +219,7 @@ Function *FunctionClone(const Function *func) {
         fn->gns = IncRef(func->gns);
         fn->status = nullptr;
         fn->lock = 0;
+        fn->receiver_tag = 0;
         fn->arity = func->arity;
         fn->flags = func->flags;
     }
@@ -232,6 +242,7 @@ Function *FunctionNew(String *name, String *doc, unsigned short arity, FunctionF
         fn->gns = nullptr;
         fn->status = nullptr;
         fn->lock = 0;
+        fn->receiver_tag = 0;
         fn->arity = arity;
         fn->flags = flags;
     }
@@ -287,6 +298,23 @@ bool argon::vm::datatype::FunctionCheckOverride(const Function *override, const
     return true;
 }
 
+bool argon::vm::datatype::FunctionCheckSpawnable(const Function *func, ArSize positional_args) {
+    if (func->currying != nullptr)
+        positional_args += func->currying->length;
+
+    if (positional_args < func->arity || (positional_args > func->arity && !func->IsVariadic())) {
+        ErrorFormat(kTypeError[0], kTypeError[3], ARGON_RAW_STRING(func->qname), func->arity, positional_args);
+        return false;
+    }
+
+    if (func->IsGenerator()) {
+        ErrorFormat(kTypeError[0], kTypeError[6], "spawn", ARGON_RAW_STRING(func->qname));
+        return false;
+    }
+
+    return true;
+}
+
 Function *argon::vm::datatype::FunctionInitGenerator(Function *func, vm::Frame *frame) {
     auto *gen = FunctionClone(func);
 
@@ -301,7 +329,33 @@ Function *argon::vm::datatype::FunctionInitGenerator(Function *func, vm::Frame *
     return gen;
 }
 
-ArObject *argon::vm::datatype::FunctionInvokeNative(Function *func, ArObject **args, ArSize count, bool kwargs) {
+bool FunctionCheckReceiver(Function *func, const ArObject *instance) {
+    const auto *type = AR_GET_TYPE(instance);
+
+    if (type == func->base)
+        return true;
+
+    // Version tags are never reused, so a matching tag always identifies the same (already checked) type
+    auto tag = TypeGetVersionTag(type);
+    if (tag != 0 && func->receiver_tag.load(std::memory_order_relaxed) == tag)
+        return true;
+
+    if (!TraitIsImplemented(type, func->base)) {
+        ErrorFormat(kTypeError[0], kTypeError[5], ARGON_RAW_STRING(func->qname), AR_TYPE_NAME(instance));
+        return false;
+    }
+
+    if (tag != 0)
+        func->receiver_tag.store(tag, std::memory_order_relaxed);
+
+    return true;
+}
+
+ArObject *argon::vm::datatype::FunctionInvokeNative(Function *func, ArObject **args, ArSize count,
+                                                    OpCodeCallMode mode) {
+    ArObject *f_args_buffer[kFunctionNativeArgsBuffer];
+    KWArgs f_kwargs_view{AROBJ_HEAD_INIT(type_kwargs_), nullptr, nullptr};
+    Dict *f_kwargs_dict = nullptr;
     ArObject **f_args = args;
     ArObject **f_args_base = nullptr;
     ArObject *f_kwargs = nullptr;
@@ -323,10 +377,15 @@ ArObject *argon::vm::datatype::FunctionInvokeNative(Function *func, ArObject **a
         f_count += func->currying->length;
 
         if (count > 0) {
-            if ((f_args_base = (ArObject **) memory::Alloc(sizeof(void *) * f_count)) == nullptr)
-                return nullptr;
+            // Borrowed references only, small argument lists are joined on the native stack
+            f_args = f_args_buffer;
+
+            if (f_count > kFunctionNativeArgsBuffer) {
+                if ((f_args_base = (ArObject **) memory::Alloc(sizeof(void *) * f_count)) == nullptr)
+                    return nullptr;
 
-            f_args = f_args_base;
+                f_args = f_args_base;
+            }
 
             for (int i = 0; i < clen; i++)
                 f_args[i] = func->currying->objects[i];
@@ -339,27 +398,43 @@ ArObject *argon::vm::datatype::FunctionInvokeNative(Function *func, ArObject **a
     if (f_count > 0 && func->IsMethod()) {
         instance = *f_args;
 
-        if (!TraitIsImplemented(AR_GET_TYPE(instance), func->base)) {
-            ErrorFormat(kTypeError[0], kTypeError[5], ARGON_RAW_STRING(func->qname), AR_TYPE_NAME(instance));
+        if (!FunctionCheckReceiver(func, instance))
             goto ERROR;
-        }
 
         f_args++;
         f_count--;
     }
 
-    if (kwargs && func->IsKWArgs()) {
+    if (f_count > 0 && ENUMBITMASK_ISTRUE(mode, OpCodeCallMode::KW_PARAMS) && func->IsKWArgs()) {
         f_kwargs = f_args[f_count - 1];
-        if (f_kwargs == (ArObject *) Nil)
-            f_kwargs = nullptr;
-
         f_count--;
+
+        if (ENUMBITMASK_ISTRUE(mode, OpCodeCallMode::KW_NAMES)) {
+            f_count -= ((Tuple *) f_kwargs)->length;
+
+            if (func->IsKWArgsView()) {
+                // Keyword values are passed as a slice of the stack, no Dict is built
+                f_kwargs_view.names = (Tuple *) f_kwargs;
+                f_kwargs_view.values = f_args + f_count;
+
+                f_kwargs = (ArObject *) &f_kwargs_view;
+            } else {
+                // The native function may keep a reference to kwargs, it needs a real Dict
+                if ((f_kwargs_dict = KWArgsToDict((Tuple *) f_kwargs, f_args + f_count)) == nullptr)
+                    goto ERROR;
+
+                f_kwargs = (ArObject *) f_kwargs_dict;
+            }
+        } else if (f_kwargs == (ArObject *) Nil)
+            f_kwargs = nullptr;
     }
 
     if (FunctionCheckParams(func->pcheck, f_args, f_count))
         ret = func->native((ArObject *) func, instance, f_args, f_kwargs, f_count);
 
     ERROR:
+    Release(f_kwargs_dict);
+
     if (f_args_base != nullptr)
         memory::Free(f_args_base);
 
@@ -464,6 +539,9 @@ Function *argon::vm::datatype::FunctionNew(const FunctionDef *func, TypeInfo *ba
     if (func->kwarg)
         flags |= FunctionFlags::KWARGS;
 
+    if (func->kwarg == kFunctionKWArgsView)
+        flags |= FunctionFlags::KWARGS_VIEW;
+
     auto *fn = ::FunctionNew(name, doc, arity, flags);
     if (fn != nullptr) {
         fn->qname = IncRef(qname);
@@ -27,13 +27,17 @@ namespace argon::vm::datatype {
 
         // Not usable at compile time
         NATIVE = 1u << 7,
-        RECOVERABLE = 1u << 8
+        RECOVERABLE = 1u << 8,
+        KWARGS_VIEW = 1u << 9
     };
 }
 
 ENUMBITMASK_ENABLE(argon::vm::datatype::FunctionFlags);
 
 namespace argon::vm::datatype {
+    /// Max number of arguments (curried + passed) joined without a heap allocation when invoking a native function.
+    constexpr unsigned short kFunctionNativeArgsBuffer = 16;
+
     struct Function {
         AROBJ_HEAD;
 
@@ -78,6 +82,9 @@ namespace argon::vm::datatype {
         /// Prevents another thread from executing this generator at the same time.
         std::atomic_uintptr_t lock;
 
+        /// Version tag of the last receiver type that passed the method check (0 if none).
+        std::atomic<ArSize> receiver_tag;
+
         /// Arity of the function, how many args accepts in input?!.
         unsigned short arity;
 
@@ -104,6 +111,10 @@ namespace argon::vm::datatype {
             return ENUMBITMASK_ISTRUE(this->flags, FunctionFlags::KWARGS);
         }
 
+        [[nodiscard]] bool IsKWArgsView() const {
+            return ENUMBITMASK_ISTRUE(this->flags, FunctionFlags::KWARGS_VIEW);
+        }
+
         [[nodiscard]] bool IsMethod() const {
             return ENUMBITMASK_ISTRUE(this->flags, FunctionFlags::METHOD);
         }
@@ -112,6 +123,22 @@ namespace argon::vm::datatype {
             return ENUMBITMASK_ISTRUE(this->flags, FunctionFlags::NATIVE);
         }
 
+        /**
+         * @brief Check if this is an Argon function that binds its positional arguments directly to its locals.
+         *
+         * A plain function is not native, async or generator, has no currying, default arguments,
+         * rest or keyword parameters. Called with exactly arity arguments, it can use the fast call path (see FrameNewPlain).
+         *
+         * @return True if the function is plain, false otherwise.
+         */
+        [[nodiscard]] bool IsPlain() const {
+            const auto not_plain = FunctionFlags::ASYNC | FunctionFlags::DEFARGS | FunctionFlags::GENERATOR |
+                                   FunctionFlags::KWARGS | FunctionFlags::VARIADIC | FunctionFlags::NATIVE |
+                                   FunctionFlags::RECOVERABLE;
+
+            return this->currying == nullptr && (unsigned short) (this->flags & not_plain) == 0;
+        }
+
         [[nodiscard]] bool IsRecoverable() const {
             return ENUMBITMASK_ISTRUE(this->flags, FunctionFlags::RECOVERABLE);
         }
@@ -132,9 +159,18 @@ namespace argon::vm::datatype {
 
     bool FunctionCheckOverride(const Function *override, const Function *overridden);
 
+    /**
+     * @brief Check if a function can be started in a new fiber with the given number of positional arguments.
+     *
+     * @param func Pointer to the function.
+     * @param positional_args Number of positional arguments passed (curried arguments excluded).
+     * @return True if the call is valid, otherwise false (panic state will be set).
+     */
+    bool FunctionCheckSpawnable(const Function *func, ArSize positional_args);
+
     Function *FunctionInitGenerator(Function *func, vm::Frame *frame);
 
-    ArObject *FunctionInvokeNative(Function *func, ArObject **args, ArSize count, bool kwargs);
+    ArObject *FunctionInvokeNative(Function *func, ArObject **args, ArSize count, OpCodeCallMode mode);
 
     Function *FunctionNew(Code *code, TypeInfo *base, Namespace *ns, Tuple *default_args,
                           List *enclosed, unsigned short arity, FunctionFlags flags);
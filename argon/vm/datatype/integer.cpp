@@ -2,7 +2,9 @@
 //
 // Licensed under the Apache License v2.0
 
+#include <array>
 #include <cmath>
+#include <utility>
 
 #include <argon/vm/runtime.h>
 
@@ -36,7 +38,7 @@ ARGON_FUNCTION(number_frombytes, frombytes,
                "- KWParameters:\n"
                "  - byteorder: Byte order used to represent the integer (big | little).\n"
                "- Returns: Number.\n",
-               "x: bytes", false, true) {
+               "x: bytes", false, kFunctionKWArgsView) {
     ArBuffer buffer{};
 
     String *byteorder = nullptr;
@@ -175,7 +177,7 @@ ARGON_METHOD(number_tobytes, tobytes,
              "- KWParameters:\n"
              "  - byteorder: Byte order used to represent the integer (big | little).\n"
              "- Returns: Bytes object.\n",
-             nullptr, false, true) {
+             nullptr, false, kFunctionKWArgsView) {
     String *byteorder = nullptr;
     bool big_endian = true;
 
@@ -616,7 +618,23 @@ TypeInfo UIntegerType = {
 };
 const TypeInfo *argon::vm::datatype::type_uint_ = &UIntegerType;
 
+// Preallocated integers, they are static objects (ignored by the refcount and never mutated in place)
+
+template<const TypeInfo *type, IntegerUnderlying offset, size_t... values>
+constexpr std::array<Integer, sizeof...(values)> MakeSmallIntegers(std::index_sequence<values...>) {
+    return {{{AROBJ_HEAD_INIT(type), {(IntegerUnderlying) values + offset}}...}};
+}
+
+static std::array<Integer, kSmallIntMax - kSmallIntMin + 1> small_int =
+        MakeSmallIntegers<&IntegerType, kSmallIntMin>(std::make_index_sequence<kSmallIntMax - kSmallIntMin + 1>{});
+
+static std::array<Integer, kSmallIntMax + 1> small_uint =
+        MakeSmallIntegers<&UIntegerType, 0>(std::make_index_sequence<kSmallIntMax + 1>{});
+
 Integer *argon::vm::datatype::IntNew(IntegerUnderlying number) {
+    if (number >= kSmallIntMin && number <= kSmallIntMax)
+        return small_int.data() + (number - kSmallIntMin);
+
     auto *si = MakeObject<Integer>(&IntegerType);
 
     if (si != nullptr) {
@@ -628,17 +646,13 @@ Integer *argon::vm::datatype::IntNew(IntegerUnderlying number) {
 }
 
 Integer *argon::vm::datatype::IntNew(const char *string, int base) {
-    auto *si = MakeObject<Integer>(&IntegerType);
-
-    if (si != nullptr) {
-        si->uint = 0;
-        si->sint = std::strtol(string, nullptr, base);
-    }
-
-    return si;
+    return IntNew(std::strtoll(string, nullptr, base));
 }
 
 Integer *argon::vm::datatype::UIntNew(UIntegerUnderlying number) {
+    if (number <= kSmallIntMax)
+        return small_uint.data() + number;
+
     auto *ui = MakeObject<Integer>(&UIntegerType);
 
     if (ui != nullptr)
@@ -648,10 +662,5 @@ Integer *argon::vm::datatype::UIntNew(UIntegerUnderlying number) {
 }
 
 Integer *argon::vm::datatype::UIntNew(const char *string, int base) {
-    auto *ui = MakeObject<Integer>(&UIntegerType);
-
-    if (ui != nullptr)
-        ui->uint = std::strtoul(string, nullptr, base);
-
-    return ui;
+    return UIntNew(std::strtoull(string, nullptr, base));
 }
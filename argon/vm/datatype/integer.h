@@ -10,10 +10,24 @@
 #include <argon/vm/datatype/arobject.h>
 #include <argon/vm/datatype/decimal.h>
 
+#ifndef ARGON_VM_SMALLINT_MIN
+#define ARGON_VM_SMALLINT_MIN   (-256)
+#endif
+
+#ifndef ARGON_VM_SMALLINT_MAX
+#define ARGON_VM_SMALLINT_MAX   1024
+#endif
+
 namespace argon::vm::datatype {
     using IntegerUnderlying = long long;
     using UIntegerUnderlying = unsigned long long;
 
+    /// Integers in the range [kSmallIntMin, kSmallIntMax] are preallocated and shared (see IntNew/UIntNew).
+    constexpr IntegerUnderlying kSmallIntMin = ARGON_VM_SMALLINT_MIN;
+    constexpr IntegerUnderlying kSmallIntMax = ARGON_VM_SMALLINT_MAX;
+
+    static_assert(kSmallIntMin <= 0 && kSmallIntMax >= 0, "small integer cache must contain zero");
+
     struct Integer {
         AROBJ_HEAD;
 
@@ -80,10 +94,27 @@ namespace argon::vm::datatype {
         return num * sign;
     }
 
+    /**
+     * @brief Create a new Int object.
+     *
+     * Small values are taken from a preallocated cache: the returned object may be shared,
+     * so it MUST NOT be modified after creation.
+     *
+     * @param number Integer value.
+     * @return A pointer to an Int object, otherwise nullptr.
+     */
     Integer *IntNew(IntegerUnderlying number);
 
     Integer *IntNew(const char *string, int base);
 
+    /**
+     * @brief Create a new UInt object.
+     *
+     * Like IntNew, small values are shared and MUST NOT be modified after creation.
+     *
+     * @param number Unsigned integer value.
+     * @return A pointer to an UInt object, otherwise nullptr.
+     */
     Integer *UIntNew(UIntegerUnderlying number);
 
     Integer *UIntNew(const char *string, int base);
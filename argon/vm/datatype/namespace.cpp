@@ -17,6 +17,17 @@ using namespace argon::vm::datatype;
 
 bool NewEntry(Namespace *, ArObject *, ArObject *, AttributeFlag);
 
+/*
+ * Each namespace draws its initial version from this counter (upper 32 bits), subsequent changes only increment
+ * the lower bits. This keeps the version unique among all namespaces without touching a shared counter
+ * on every store.
+ */
+static std::atomic<std::uint64_t> namespace_version = 0;
+
+inline void VersionBump(Namespace *ns) {
+    ns->version.fetch_add(1, std::memory_order_release);
+}
+
 ArObject *namespace_compare(Namespace *self, ArObject *other, CompareMode mode) {
     auto *o = (Namespace *) other;
 
@@ -239,6 +250,9 @@ bool argon::vm::datatype::NamespaceSet(Namespace *ns, ArObject *key, ArObject *v
 
     if (entry != nullptr) {
         entry->value.value.Store(value, !entry->value.properties.IsWeak());
+
+        VersionBump(ns);
+
         return true;
     }
 
@@ -263,6 +277,8 @@ bool argon::vm::datatype::NamespaceSetPositional(Namespace *ns, ArObject **value
         cursor->value.value.Store(values[idx++], !cursor->value.properties.IsWeak());
     }
 
+    VersionBump(ns);
+
     return count <= idx;
 }
 
@@ -272,6 +288,8 @@ bool NewEntry(Namespace *ns, ArObject *key, ArObject *value, AttributeFlag aa) {
     if (!ns->ns.Lookup(key, &entry))
         return false;
 
+    VersionBump(ns);
+
     if (entry != nullptr) {
         entry->value.value.Store(value, ENUMBITMASK_ISFALSE(aa, AttributeFlag::WEAK));
         entry->value.properties.flags = aa;
@@ -328,6 +346,8 @@ Namespace *argon::vm::datatype::NamespaceNew() {
 
         new(&ns->rwlock)sync::RecursiveSharedMutex();
 
+        ns->version = (namespace_version.fetch_add(1, std::memory_order_relaxed) + 1) << 32u;
+
         memory::Track((ArObject*)ns);
     }
 
@@ -380,6 +400,8 @@ Set *argon::vm::datatype::NamespaceKeysToSet(Namespace *ns, AttributeFlag match)
 [[maybe_unused]] void argon::vm::datatype::NamespaceClear(Namespace *ns) {
     std::unique_lock _(ns->rwlock);
 
+    VersionBump(ns);
+
     ns->ns.Clear([](NSEntry *entry) {
         Release(entry->key);
         entry->value.value.Release();
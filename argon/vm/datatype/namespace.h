@@ -5,6 +5,8 @@
 #ifndef ARGON_VM_DATATYPE_NAMESPACE_H_
 #define ARGON_VM_DATATYPE_NAMESPACE_H_
 
+#include <cstdint>
+
 #include <argon/vm/sync/rsm.h>
 
 #include <argon/util/macros.h>
@@ -69,6 +71,9 @@ namespace argon::vm::datatype {
         sync::RecursiveSharedMutex rwlock;
 
         HashMap<ArObject, PropertyStore> ns;
+
+        /// Changes every time an entry is inserted, replaced or removed (never 0, unique among all namespaces).
+        std::atomic<std::uint64_t> version;
     };
     _ARGONAPI extern const TypeInfo *type_namespace_;
 
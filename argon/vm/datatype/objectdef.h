@@ -99,6 +99,12 @@ namespace argon::vm::datatype {
 
     using FunctionPtr = ArObject *(*)(ArObject *, ArObject *, ArObject **, ArObject *, ArSize);
 
+    /*
+     * Value for FunctionDef::kwarg: the native function reads its keyword parameters only through
+     * the KParam* utilities, so they can be passed as a borrowed KWArgs view instead of a new Dict.
+     */
+    constexpr unsigned char kFunctionKWArgsView = 2;
+
     struct FunctionDef {
         /* Name of native function (this name will be exposed to Argon) */
         const char *name;
@@ -115,8 +121,8 @@ namespace argon::vm::datatype {
         /* Is a variadic function? (func variadic(p1,p2,...p3)) */
         bool variadic;
 
-        /* Can it accept keyword parameters?? (func kwargs(p1="", p2=2)) */
-        bool kwarg;
+        /* Can it accept keyword parameters?? (func kwargs(p1="", p2=2)), true or kFunctionKWArgsView */
+        unsigned char kwarg;
 
         /* Export as a method or like a normal(static) function? (used by TypeInit) */
         bool method;
@@ -339,6 +345,9 @@ ArObject *name##_fn(ArObject *_func, ArObject *_self, ArObject **args, ArObject
         ArObject *mro;
 
         ArObject *tp_map;
+
+        /// Version tag used by attribute caches (0 means that the tag has not yet been assigned or has been invalidated).
+        std::atomic<ArSize> version_tag{0};
     };
 
     struct ArObject {
@@ -352,7 +361,8 @@ ArObject *name##_fn(ArObject *_func, ArObject *_self, ArObject **args, ArObject
 #define AR_GET_MON(object)                  (AR_GET_HEAD(object).mon_)
 #define AR_UNSAFE_GET_MON(object)           (*((Monitor **) &AR_GET_HEAD(object).mon_))
 
-#define AR_SAFE_TO_MUTATE(object)           (AR_UNSAFE_GET_RC(object) <= 0x13)
+#define AR_SAFE_TO_MUTATE(object)           (AR_UNSAFE_GET_RC(object) <= 0x13 && \
+                                            !(AR_UNSAFE_GET_RC(object) & argon::vm::memory::RCBitOffsets::StaticMask))
 
 #define AR_SLOT_BUFFER(object)              ((AR_GET_TYPE(object))->buffer)
 #define AR_SLOT_NUMBER(object)              ((AR_GET_TYPE(object))->number)
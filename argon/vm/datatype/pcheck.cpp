@@ -71,6 +71,33 @@ TypeInfo PCheckType = {
 };
 const TypeInfo *argon::vm::datatype::type_pcheck_ = &PCheckType;
 
+TypeInfo KWArgsType = {
+        AROBJ_HEAD_INIT_TYPE,
+        "KWArgs",
+        nullptr,
+        nullptr,
+        sizeof(KWArgs),
+        TypeInfoFlags::BASE,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr
+};
+const TypeInfo *argon::vm::datatype::type_kwargs_ = &KWArgsType;
+
 unsigned short CountParams(const char *format) {
     if (format == nullptr || *format == '\0')
         return 0;
@@ -100,7 +127,7 @@ unsigned short CountTypes(const char *format, const char **start_name) {
     return count;
 }
 
-void SetType(Param *param, const char *start, const char *end) {
+int SetType(Param *param, const char *start, const char *end) {
     int index = 0;
 
     while (start < end) {
@@ -171,6 +198,8 @@ void SetType(Param *param, const char *start, const char *end) {
                 break; // Ignore!
         }
     }
+
+    return index;
 }
 
 bool InitParam(Param **param, const char **descriptor) {
@@ -222,10 +251,13 @@ bool InitParam(Param **param, const char **descriptor) {
 
     (*param)->name = name;
 
+    type_length = 0;
     if (type_start != type_end)
-        SetType(*param, type_start, type_end);
+        type_length = SetType(*param, type_start, type_end);
 
-    (*param)->types[type_length - 1] = nullptr; // sentinel
+    (*param)->types[type_length] = nullptr; // sentinel
+
+    (*param)->expected = type_length == 1 ? (*param)->types[0] : nullptr;
 
     return true;
 }
@@ -236,6 +268,7 @@ PCheck *argon::vm::datatype::PCheckNew(const char *description) {
         return nullptr;
 
     pc->count = CountParams(description);
+    pc->typed = 0;
 
     if (pc->count == 0) {
         pc->params = nullptr;
@@ -254,6 +287,9 @@ PCheck *argon::vm::datatype::PCheckNew(const char *description) {
             return nullptr;
         }
 
+        if (index < kPCheckMaskBits && *pc->params[index]->types != nullptr)
+            pc->typed |= (ArSize) 1 << index;
+
         if (*description == ',')
             description++;
 
@@ -290,6 +326,69 @@ bool argon::vm::datatype::VariadicCheckPositional(const char *name, unsigned int
 
 // KWParameters utilities
 
+ArObject *argon::vm::datatype::KWArgsLookup(const Tuple *names, ArObject **values, const String *key) {
+    // Scan backwards, if a keyword is repeated the last value wins (as with a Dict)
+    for (ArSize i = names->length; i > 0; i--) {
+        const auto *name = (const String *) names->objects[i - 1];
+
+        if (name == key || (ARGON_RAW_STRING_LENGTH(name) == ARGON_RAW_STRING_LENGTH(key)
+                            && argon::vm::memory::MemoryCompare(ARGON_RAW_STRING(name), ARGON_RAW_STRING(key),
+                                                                ARGON_RAW_STRING_LENGTH(key)) == 0))
+            return values[i - 1];
+    }
+
+    return nullptr;
+}
+
+Dict *argon::vm::datatype::KWArgsToDict(const Tuple *names, ArObject **values) {
+    auto *dict = DictNew();
+    if (dict == nullptr)
+        return nullptr;
+
+    for (ArSize i = 0; i < names->length; i++) {
+        if (!DictInsert(dict, names->objects[i], values[i])) {
+            Release(dict);
+            return nullptr;
+        }
+    }
+
+    return dict;
+}
+
+bool KParamGet(Dict *kwargs, const char *key, ArObject **out) {
+    // The KParam* functions receive what was passed to the native: a Dict or, for the natives
+    // declared with kFunctionKWArgsView, a KWArgs view. Anything else is a caller error
+    if (AR_TYPEOF(kwargs, type_dict_))
+        return DictLookup(kwargs, key, out);
+
+    if (!AR_TYPEOF(kwargs, type_kwargs_)) {
+        ErrorFormat(kTypeError[0], kTypeError[2], type_dict_->name, AR_TYPE_QNAME(kwargs));
+        return false;
+    }
+
+    const auto *kw = (const KWArgs *) kwargs;
+    String *ikey;
+
+    *out = nullptr;
+
+    if ((ikey = StringIntern(key)) == nullptr)
+        return false;
+
+    for (ArSize i = kw->names->length; i > 0; i--) {
+        const auto *name = (const String *) kw->names->objects[i - 1];
+
+        // Names emitted by the compiler are interned, compare the content only if one is not
+        if (name == ikey || (!name->intern && StringCompare(name, ikey) == 0)) {
+            *out = IncRef(kw->values[i - 1]);
+            break;
+        }
+    }
+
+    Release(ikey);
+
+    return true;
+}
+
 bool argon::vm::datatype::KParamLookup(Dict *kwargs, const char *key, const TypeInfo *type,
                                        ArObject **out, ArObject *_default, bool nil_as_default) {
     ArObject *obj;
@@ -301,7 +400,7 @@ bool argon::vm::datatype::KParamLookup(Dict *kwargs, const char *key, const Type
         return true;
     }
 
-    if (!DictLookup(kwargs, key, &obj))
+    if (!KParamGet(kwargs, key, &obj))
         return false;
 
     if (obj == nullptr) {
@@ -343,7 +442,7 @@ bool argon::vm::datatype::KParamLookupBool(Dict *kwargs, const char *key, bool *
         return true;
     }
 
-    if (!DictLookup(kwargs, key, &obj))
+    if (!KParamGet(kwargs, key, &obj))
         return false;
 
     if (obj == nullptr) {
@@ -373,7 +472,7 @@ bool argon::vm::datatype::KParamLookupInt(Dict *kwargs, const char *key,
         return true;
     }
 
-    if (!DictLookup(kwargs, key, &obj))
+    if (!KParamGet(kwargs, key, &obj))
         return false;
 
     if (obj == nullptr) {
@@ -402,7 +501,7 @@ bool argon::vm::datatype::KParamLookupStr(Dict *kwargs, const char *key, String
                                           const char *_default, bool *out_isdef) {
     ArObject *obj = nullptr;
 
-    if (kwargs != nullptr && !DictLookup(kwargs, key, &obj))
+    if (kwargs != nullptr && !KParamGet(kwargs, key, &obj))
         return false;
 
     if (obj == nullptr) {
@@ -447,7 +546,7 @@ bool argon::vm::datatype::KParamLookupUInt(Dict *kwargs, const char *key,
         return true;
     }
 
-    if (!DictLookup(kwargs, key, &obj))
+    if (!KParamGet(kwargs, key, &obj))
         return false;
 
     if (obj == nullptr) {
@@ -472,3 +571,14 @@ bool argon::vm::datatype::KParamLookupUInt(Dict *kwargs, const char *key,
     return true;
 }
 
+Dict *argon::vm::datatype::KParamToDict(ArObject *kwargs) {
+    if (AR_TYPEOF(kwargs, type_kwargs_))
+        return KWArgsToDict(((KWArgs *) kwargs)->names, ((KWArgs *) kwargs)->values);
+
+    if (!AR_TYPEOF(kwargs, type_dict_)) {
+        ErrorFormat(kTypeError[0], kTypeError[2], type_dict_->name, AR_TYPE_QNAME(kwargs));
+        return nullptr;
+    }
+
+    return (Dict *) IncRef(kwargs);
+}
@@ -121,7 +121,7 @@ ARGON_METHOD(set_discard, discard,
              "\n"
              "- Parameter ...object: Object to remove from set.\n"
              "- Returns: Set itself.\n",
-             nullptr, true, true) {
+             nullptr, true, kFunctionKWArgsView) {
     auto *self = (Set *) _self;
     SetEntry *tmp;
 
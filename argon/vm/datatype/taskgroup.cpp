@@ -0,0 +1,373 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#include <shared_mutex>
+
+#include <argon/vm/runtime.h>
+
+#include <argon/vm/datatype/boolean.h>
+#include <argon/vm/datatype/error.h>
+#include <argon/vm/datatype/function.h>
+#include <argon/vm/datatype/integer.h>
+#include <argon/vm/datatype/nil.h>
+#include <argon/vm/datatype/stringformatter.h>
+
+#include <argon/vm/datatype/taskgroup.h>
+
+using namespace argon::vm::datatype;
+
+ARGON_FUNCTION(taskgroup_taskgroup, TaskGroup,
+               "Create a new TaskGroup object.\n"
+               "\n"
+               "A TaskGroup runs a set of calls in new fibers and collects their results. "
+               "Calls added with add/map are started together by start/wait with a single "
+               "scheduler operation. If a call panics, the calls that have not started yet are cancelled.\n"
+               "\n"
+               "- Returns: New TaskGroup object.\n",
+               nullptr, false, false) {
+    return (ArObject *) TaskGroupNew();
+}
+
+ARGON_METHOD(taskgroup_add, add,
+             "Add a call to the group.\n"
+             "\n"
+             "The call does not start immediately, see start/wait.\n"
+             "\n"
+             "- Parameters:\n"
+             "    - func: function to call.\n"
+             "    - ...obj: arguments.\n"
+             "- Returns: Index of the call result.\n",
+             "F: func", true, false) {
+    auto *self = (TaskGroup *) _self;
+
+    if (!TaskGroupAdd(self, args[0], args + 1, argc - 1))
+        return nullptr;
+
+    return (ArObject *) UIntNew(self->count - 1);
+}
+
+ARGON_METHOD(taskgroup_cancel, cancel,
+             "Cancel the calls that have not started yet.\n"
+             "\n"
+             "Running calls are not interrupted, the results of the cancelled calls are nil.\n",
+             nullptr, false, false) {
+    TaskGroupCancel((TaskGroup *) _self);
+
+    return (ArObject *) IncRef(Nil);
+}
+
+ARGON_METHOD(taskgroup_map, map,
+             "Add a call to func for each element of the iterable.\n"
+             "\n"
+             "- Parameters:\n"
+             "    - func: function to call.\n"
+             "    - iterable: elements passed as the only argument to func.\n"
+             "- Returns: nil.\n",
+             "F: func, : iterable", false, false) {
+    auto *self = (TaskGroup *) _self;
+    ArObject *item;
+
+    auto *iter = IteratorGet(args[1], false);
+    if (iter == nullptr)
+        return nullptr;
+
+    while ((item = IteratorNext(iter)) != nullptr) {
+        if (!TaskGroupAdd(self, args[0], &item, 1)) {
+            Release(item);
+            Release(iter);
+
+            return nullptr;
+        }
+
+        Release(item);
+    }
+
+    Release(iter);
+
+    if (argon::vm::IsPanicking())
+        return nullptr;
+
+    return (ArObject *) IncRef(Nil);
+}
+
+ARGON_METHOD(taskgroup_start, start,
+             "Start the calls added to the group.\n"
+             "\n"
+             "- Returns: nil.\n",
+             nullptr, false, false) {
+    if (!TaskGroupStart((TaskGroup *) _self))
+        return nullptr;
+
+    return (ArObject *) IncRef(Nil);
+}
+
+ARGON_METHOD(taskgroup_wait, wait,
+             "Start the calls added to the group and wait for them.\n"
+             "\n"
+             "The wait ends as soon as all calls are completed or one of them panics, "
+             "in the latter case the calls that have not started yet are cancelled and "
+             "the panic is propagated to the caller.\n"
+             "\n"
+             "- Returns: Tuple containing the results of the calls in spawn order.\n",
+             nullptr, false, false) {
+    return (ArObject *) TaskGroupWait((TaskGroup *) _self);
+}
+
+const FunctionDef taskgroup_methods[] = {
+        taskgroup_taskgroup,
+
+        taskgroup_add,
+        taskgroup_cancel,
+        taskgroup_map,
+        taskgroup_start,
+        taskgroup_wait,
+        ARGON_METHOD_SENTINEL
+};
+
+const ObjectSlots taskgroup_objslot = {
+        taskgroup_methods,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        -1
+};
+
+ArObject *taskgroup_compare(const ArObject *self, const ArObject *other, CompareMode mode) {
+    if (!AR_SAME_TYPE(self, other) || mode != CompareMode::EQ)
+        return nullptr;
+
+    return BoolToArBool(self == other);
+}
+
+ArObject *taskgroup_repr(const TaskGroup *self) {
+    return (ArObject *) StringFormat("<%s -- calls: %d, staged: %d, pending: %d, cancelled: %s>",
+                                     type_taskgroup_->name, self->count, self->staged_count, self->pending,
+                                     self->cancelled.load() ? "true" : "false");
+}
+
+bool taskgroup_dtor(TaskGroup *self) {
+    for (unsigned int i = 0; i < self->staged_count; i++)
+        Release(self->staged[i]);
+
+    for (unsigned int i = 0; i < self->count; i++)
+        Release(self->results[i]);
+
+    Release(self->error);
+
+    self->lock.~RecursiveSharedMutex();
+    self->queue.~NotifyQueue();
+
+    argon::vm::memory::Free(self->staged);
+    argon::vm::memory::Free(self->results);
+
+    return true;
+}
+
+void taskgroup_trace(TaskGroup *self, Void_UnaryOp trace) {
+    std::shared_lock _(self->lock);
+
+    for (unsigned int i = 0; i < self->staged_count; i++)
+        trace((ArObject *) self->staged[i]);
+
+    for (unsigned int i = 0; i < self->count; i++)
+        trace(self->results[i]);
+
+    trace(self->error);
+}
+
+TypeInfo TaskGroupType = {
+        AROBJ_HEAD_INIT_TYPE,
+        "TaskGroup",
+        nullptr,
+        nullptr,
+        sizeof(TaskGroup),
+        TypeInfoFlags::BASE,
+        nullptr,
+        (Bool_UnaryOp) taskgroup_dtor,
+        (TraceOp) taskgroup_trace,
+        nullptr,
+        nullptr,
+        taskgroup_compare,
+        (UnaryConstOp) taskgroup_repr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        &taskgroup_objslot,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr
+};
+const TypeInfo *argon::vm::datatype::type_taskgroup_ = &TaskGroupType;
+
+bool argon::vm::datatype::TaskGroupAdd(TaskGroup *group, ArObject *func, ArObject **argv, ArSize argc) {
+    Tuple *call;
+
+    if (!FunctionCheckSpawnable((Function *) func, argc))
+        return false;
+
+    if ((call = TupleNew(argc + 1)) == nullptr)
+        return false;
+
+    TupleInsert(call, func, 0);
+
+    for (ArSize i = 0; i < argc; i++)
+        TupleInsert(call, argv[i], i + 1);
+
+    std::unique_lock _(group->lock);
+
+    if (group->count == group->capacity) {
+        auto capacity = group->capacity * 2;
+
+        auto *staged = (Tuple **) memory::Realloc(group->staged, capacity * sizeof(void *));
+        if (staged == nullptr) {
+            Release(call);
+            return false;
+        }
+
+        group->staged = staged;
+
+        auto *results = (ArObject **) memory::Realloc(group->results, capacity * sizeof(void *));
+        if (results == nullptr) {
+            Release(call);
+            return false;
+        }
+
+        group->results = results;
+        group->capacity = capacity;
+    }
+
+    group->staged[group->staged_count++] = call;
+    group->results[group->count++] = nullptr;
+
+    memory::TrackIf((ArObject *) group, (ArObject *) call);
+
+    return true;
+}
+
+void argon::vm::datatype::TaskGroupCancel(TaskGroup *group) {
+    std::unique_lock _(group->lock);
+
+    group->cancelled = true;
+
+    for (unsigned int i = 0; i < group->staged_count; i++)
+        Release(group->staged[i]);
+
+    group->staged_count = 0;
+}
+
+void argon::vm::datatype::TaskGroupDone(TaskGroup *group, unsigned int index, ArObject *result, ArObject *error) {
+    std::unique_lock _(group->lock);
+
+    bool first_error = false;
+
+    if (result != nullptr) {
+        group->results[index] = IncRef(result);
+
+        memory::TrackIf((ArObject *) group, result);
+    } else if (error != nullptr && group->error == nullptr) {
+        group->error = IncRef(error);
+        group->cancelled = true;
+
+        memory::TrackIf((ArObject *) group, error);
+
+        first_error = true;
+    }
+
+    group->pending--;
+
+    if (group->pending == 0 || first_error)
+        group->queue.NotifyAll();
+}
+
+bool argon::vm::datatype::TaskGroupStart(TaskGroup *group) {
+    std::unique_lock _(group->lock);
+
+    if (group->staged_count == 0)
+        return true;
+
+    auto index = group->count - group->staged_count;
+
+    if (!group->cancelled) {
+        if (!argon::vm::SpawnGroup(group, group->staged, group->staged_count, index))
+            return false;
+
+        group->pending += group->staged_count;
+    }
+
+    for (unsigned int i = 0; i < group->staged_count; i++)
+        Release(group->staged[i]);
+
+    group->staged_count = 0;
+
+    return true;
+}
+
+Tuple *argon::vm::datatype::TaskGroupWait(TaskGroup *group) {
+    Tuple *ret;
+
+    std::unique_lock lock(group->lock);
+
+    if (!TaskGroupStart(group))
+        return nullptr;
+
+    if (group->error != nullptr) {
+        auto *error = IncRef(group->error);
+
+        lock.unlock();
+
+        Panic(error);
+
+        Release(error);
+
+        return nullptr;
+    }
+
+    if (group->pending > 0) {
+        group->queue.Wait(FiberStatus::BLOCKED_SUSPENDED);
+
+        return nullptr;
+    }
+
+    if ((ret = TupleNew(group->count)) == nullptr)
+        return nullptr;
+
+    for (unsigned int i = 0; i < group->count; i++)
+        TupleInsert(ret, group->results[i] != nullptr ? group->results[i] : (ArObject *) Nil, i);
+
+    return ret;
+}
+
+TaskGroup *argon::vm::datatype::TaskGroupNew() {
+    auto *group = MakeGCObject<TaskGroup>(type_taskgroup_);
+
+    if (group != nullptr) {
+        new(&group->lock)sync::RecursiveSharedMutex();
+        new(&group->queue)sync::NotifyQueue();
+
+        group->staged = nullptr;
+        group->results = nullptr;
+        group->error = nullptr;
+
+        group->staged_count = 0;
+        group->count = 0;
+        group->capacity = kTaskGroupInitialCapacity;
+        group->pending = 0;
+
+        group->cancelled = false;
+
+        group->staged = (Tuple **) memory::Alloc(kTaskGroupInitialCapacity * sizeof(void *));
+        group->results = (ArObject **) memory::Alloc(kTaskGroupInitialCapacity * sizeof(void *));
+
+        if (group->staged == nullptr || group->results == nullptr) {
+            Release(group);
+            return nullptr;
+        }
+    }
+
+    return group;
+}
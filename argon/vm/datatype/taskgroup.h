@@ -0,0 +1,108 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#ifndef ARGON_VM_DATATYPE_TASKGROUP_H_
+#define ARGON_VM_DATATYPE_TASKGROUP_H_
+
+#include <atomic>
+
+#include <argon/vm/sync/notifyqueue.h>
+#include <argon/vm/sync/rsm.h>
+
+#include <argon/vm/datatype/arobject.h>
+#include <argon/vm/datatype/tuple.h>
+
+namespace argon::vm::datatype {
+    constexpr const unsigned int kTaskGroupInitialCapacity = 8;
+
+    struct TaskGroup {
+        AROBJ_HEAD;
+
+        sync::RecursiveSharedMutex lock;
+
+        /// Fibers waiting for the group to complete.
+        sync::NotifyQueue queue;
+
+        /// Calls not yet started, each one is a tuple (func, args...).
+        Tuple **staged;
+
+        /// Results of the calls in spawn order (nullptr = not completed, cancelled or panicked).
+        ArObject **results;
+
+        /// Error of the first call that panicked (if any...).
+        ArObject *error;
+
+        /// Number of staged calls.
+        unsigned int staged_count;
+
+        /// Number of calls spawned in this group (started or not).
+        unsigned int count;
+
+        /// Capacity of staged and results arrays.
+        unsigned int capacity;
+
+        /// Fibers started and not yet completed.
+        unsigned int pending;
+
+        /// If true, fibers that have not started yet are discarded.
+        std::atomic_bool cancelled;
+    };
+    _ARGONAPI extern const TypeInfo *type_taskgroup_;
+
+    /**
+     * @brief Add a call to the group.
+     *
+     * The call is staged, it will start with the other staged calls at the next TaskGroupStart.
+     *
+     * @param group TaskGroup object.
+     * @param func Function to call.
+     * @param argv Arguments.
+     * @param argc Number of arguments.
+     * @return True on success, false otherwise.
+     */
+    bool TaskGroupAdd(TaskGroup *group, ArObject *func, ArObject **argv, ArSize argc);
+
+    /**
+     * @brief Cancel the calls of the group that have not started yet.
+     *
+     * Running calls are not interrupted.
+     *
+     * @param group TaskGroup object.
+     */
+    void TaskGroupCancel(TaskGroup *group);
+
+    /**
+     * @brief Notify the group that one of its fibers has completed.
+     *
+     * @param group TaskGroup object.
+     * @param index Index of the call.
+     * @param result Result of the call (nullptr if the call panicked or was cancelled).
+     * @param error Panic object (nullptr if the call succeeded or was cancelled).
+     */
+    void TaskGroupDone(TaskGroup *group, unsigned int index, ArObject *result, ArObject *error);
+
+    /**
+     * @brief Start all the staged calls with a single enqueue operation on the scheduler (see SpawnGroup).
+     *
+     * @param group TaskGroup object.
+     * @return True on success, false otherwise.
+     */
+    bool TaskGroupStart(TaskGroup *group);
+
+    /**
+     * @brief Start the staged calls and wait until all calls are completed or one of them panics.
+     *
+     * If the calls are not yet completed, the current fiber is suspended and the function returns nullptr,
+     * the caller MUST be re-executed when the fiber is resumed (like ChanRead).
+     *
+     * @param group TaskGroup object.
+     * @return A tuple containing the results of the calls in spawn order, otherwise nullptr.
+     */
+    Tuple *TaskGroupWait(TaskGroup *group);
+
+    TaskGroup *TaskGroupNew();
+
+} // namespace argon::vm::datatype
+
+#endif // !ARGON_VM_DATATYPE_TASKGROUP_H_
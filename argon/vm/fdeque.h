@@ -0,0 +1,202 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#ifndef ARGON_VM_FDEQUE_H_
+#define ARGON_VM_FDEQUE_H_
+
+#include <atomic>
+
+#include <argon/vm/datatype/objectdef.h>
+
+#include <argon/vm/fiber.h>
+
+namespace argon::vm {
+    constexpr unsigned short kFiberDequeCacheLine = 64;
+
+    /**
+     * @brief Bounded lock-free work-stealing deque (Chase-Lev).
+     *
+     * Only the thread that owns the deque (the OSThread wired to the VCore) can call Enqueue and StealDequeue,
+     * any thread can call Dequeue, StealBatch and IsEmpty.
+     *
+     * The owner pushes at the bottom, everyone (owner included) takes from the top (FIFO)
+     * using a CAS on top as the only synchronization point.
+     *
+     * @tparam length Max number of fibers in the deque (must be a power of two).
+     */
+    template<unsigned int length>
+    class FiberDeque {
+        static_assert(length > 1 && (length & (length - 1)) == 0, "FiberDeque length must be a power of two");
+
+        static constexpr datatype::ArSSize kMask = length - 1;
+
+        //                  top (thieves)          bottom (owner)
+        //                  v                      v
+        // +-------+-------+-------+-------+-------+-------+
+        // |       |       | obj1  | obj2  | obj3  |       |
+        // +-------+-------+-------+-------+-------+-------+
+        std::atomic<datatype::ArSSize> top_ = 0;
+
+        // Keep top and bottom in different cache lines, they are written by different threads
+        char pad_top_[kFiberDequeCacheLine - sizeof(std::atomic<datatype::ArSSize>)]{};
+
+        std::atomic<datatype::ArSSize> bottom_ = 0;
+
+        char pad_bottom_[kFiberDequeCacheLine - sizeof(std::atomic<datatype::ArSSize>)]{};
+
+        std::atomic<Fiber *> buffer_[length]{};
+
+        /**
+         * @brief Try to remove a fiber from the top of the deque.
+         *
+         * @param fiber Pointer to a variable that receives the fiber.
+         * @return false if the CAS on top was lost to another thread (fiber is set to nullptr), true otherwise.
+         */
+        bool TryDequeue(Fiber **fiber) {
+            auto top = this->top_.load(std::memory_order_acquire);
+
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            auto bottom = this->bottom_.load(std::memory_order_acquire);
+
+            *fiber = nullptr;
+
+            if (top >= bottom)
+                return true;
+
+            auto *ret = this->buffer_[top & kMask].load(std::memory_order_relaxed);
+
+            if (!this->top_.compare_exchange_strong(top, top + 1,
+                                                    std::memory_order_seq_cst,
+                                                    std::memory_order_relaxed))
+                return false;
+
+            *fiber = ret;
+
+            return true;
+        }
+
+    public:
+        FiberDeque() = default;
+
+        /**
+         * @brief Remove the oldest fiber from the deque (FIFO).
+         *
+         * @return Fiber if present, nullptr otherwise.
+         */
+        Fiber *Dequeue() {
+            Fiber *fiber;
+
+            while (!this->TryDequeue(&fiber));
+
+            return fiber;
+        }
+
+        /**
+         * @brief Steal half of queued items from another deque (owner only).
+         *
+         * @param min_len Minimum target deque length for stealing items in the deque.
+         * @param deque Other deque.
+         * @return Dequeue an item from the deque if present, otherwise return nullptr.
+         */
+        Fiber *StealDequeue(unsigned short min_len, FiberDeque &deque) {
+            auto items = deque.Size();
+            Fiber *fiber;
+
+            if (items == 0 || items < min_len)
+                return nullptr;
+
+            auto grab_len = (items / 2) + (items & 1u);
+            auto room = length - this->Size();
+
+            if (grab_len > room)
+                grab_len = room;
+
+            // A lost race means that someone else is consuming the same deque, give up
+            if (!deque.TryDequeue(&fiber) || fiber == nullptr)
+                return nullptr;
+
+            for (unsigned int i = 1; i < grab_len; i++) {
+                Fiber *next;
+
+                if (!deque.TryDequeue(&next) || next == nullptr)
+                    break;
+
+                this->Enqueue(next);
+            }
+
+            return fiber;
+        }
+
+        /**
+         * @brief Insert fiber at the bottom of the deque (owner only).
+         *
+         * @param fiber to insert.
+         * @return Returns true if the item has been added to the deque,
+         * otherwise false(the maximum number of items in the deque reached).
+         */
+        bool Enqueue(Fiber *fiber) {
+            if (fiber == nullptr)
+                return true;
+
+            auto bottom = this->bottom_.load(std::memory_order_relaxed);
+            auto top = this->top_.load(std::memory_order_acquire);
+
+            if (bottom - top >= (datatype::ArSSize) length)
+                return false;
+
+            this->buffer_[bottom & kMask].store(fiber, std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_release);
+
+            this->bottom_.store(bottom + 1, std::memory_order_relaxed);
+
+            return true;
+        }
+
+        /**
+         * @brief Check if deque is empty or not.
+         *
+         * @return true if empty, false otherwise (the result is only a snapshot if the deque is shared).
+         */
+        bool IsEmpty() const {
+            return this->Size() == 0;
+        }
+
+        /**
+         * @brief Remove up to max_items of the oldest fibers from the deque.
+         *
+         * @param fibers Array that receives the removed fibers.
+         * @param max_items Max number of fibers to remove.
+         * @return Number of removed fibers.
+         */
+        unsigned int StealBatch(Fiber **fibers, unsigned int max_items) {
+            unsigned int count = 0;
+
+            while (count < max_items) {
+                auto *fiber = this->Dequeue();
+                if (fiber == nullptr)
+                    break;
+
+                fibers[count++] = fiber;
+            }
+
+            return count;
+        }
+
+        /**
+         * @brief Get the number of fibers in the deque.
+         *
+         * @return Number of fibers (the result is only a snapshot if the deque is shared).
+         */
+        unsigned int Size() const {
+            auto top = this->top_.load(std::memory_order_acquire);
+            auto bottom = this->bottom_.load(std::memory_order_acquire);
+
+            return bottom > top ? (unsigned int) (bottom - top) : 0;
+        }
+    };
+} // namespace argon::vm
+
+#endif // !ARGON_VM_FDEQUE_H_
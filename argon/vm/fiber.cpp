@@ -10,37 +10,143 @@
 using namespace argon::vm;
 using namespace argon::vm::datatype;
 
+// Per OS thread cache of stack chunks (see FiberChunkCacheEnable)
+struct ChunkCache {
+    StackChunk *head;
+
+    unsigned short count;
+
+    bool enabled;
+};
+
+thread_local ChunkCache chunk_cache{};
+
+StackChunk *ChunkAlloc(unsigned int size) {
+    auto **cursor = &chunk_cache.head;
+
+    // First fit, the cache holds a few chunks at most
+    for (; *cursor != nullptr; cursor = &(*cursor)->next) {
+        if ((*cursor)->size >= size) {
+            auto *chunk = *cursor;
+
+            *cursor = chunk->next;
+            chunk_cache.count--;
+
+            return chunk;
+        }
+    }
+
+    auto *chunk = (StackChunk *) memory::Alloc(sizeof(StackChunk) + size);
+    if (chunk != nullptr)
+        chunk->size = size;
+
+    return chunk;
+}
+
+void ChunkRelease(StackChunk *chunk) {
+    if (!chunk_cache.enabled || chunk_cache.count >= kFiberChunkCacheMax) {
+        memory::Free(chunk);
+        return;
+    }
+
+    chunk->next = chunk_cache.head;
+    chunk_cache.head = chunk;
+    chunk_cache.count++;
+}
+
 Frame *Fiber::FrameAlloc(unsigned int size, bool floating) {
-    auto *ret = (Frame *) this->stack_cur;
     auto requested = sizeof(Frame) + (size * sizeof(void *));
+    Frame *ret;
 
-    bool on_stack = false;
+    if (floating) {
+        if ((ret = (Frame *) memory::Alloc(requested)) != nullptr)
+            memory::MemoryZero(ret, sizeof(Frame));
 
-    if (!floating && ((((unsigned char *) this->stack_cur) + requested) < this->stack_end)) {
-        this->stack_cur = (((unsigned char *) this->stack_cur) + requested);
+        return ret;
+    }
 
-        on_stack = true;
-    } else
-        ret = (Frame *) memory::Alloc(requested);
+    if ((((unsigned char *) this->stack_cur) + requested) > this->stack_end && !this->StackGrow(requested))
+        return nullptr;
 
-    if (ret != nullptr) {
-        memory::MemoryZero(ret, sizeof(Frame));
+    ret = (Frame *) this->stack_cur;
 
-        if (on_stack)
-            ret->fiber_id = (ArSize) this;
-    }
+    this->stack_cur = ((unsigned char *) this->stack_cur) + requested;
+
+    memory::MemoryZero(ret, sizeof(Frame));
+
+    ret->fiber_id = (ArSize) this;
 
     return ret;
 }
 
+bool Fiber::StackGrow(unsigned long requested) {
+    auto size = this->chunk_size > 0 ? this->chunk_size : kFiberChunkSize;
+    StackChunk *chunk;
+
+    if (this->chunk != nullptr) {
+        size = this->chunk->size * 2;
+
+        if (size > kFiberChunkSizeMax)
+            size = kFiberChunkSizeMax;
+    }
+
+    if (size < requested)
+        size = (unsigned int) requested;
+
+    if (this->chunk_spare != nullptr && this->chunk_spare->size >= size) {
+        chunk = this->chunk_spare;
+        this->chunk_spare = nullptr;
+    } else if ((chunk = ChunkAlloc(size)) == nullptr)
+        return false;
+
+    chunk->prev = this->chunk;
+    chunk->prev_cur = this->stack_cur;
+    chunk->prev_end = this->stack_end;
+
+    this->chunk = chunk;
+    this->stack_cur = chunk->data;
+    this->stack_end = ((unsigned char *) chunk->data) + chunk->size;
+
+    return true;
+}
+
+void Fiber::StackShrink() {
+    auto *chunk = this->chunk;
+
+    assert(chunk != nullptr);
+
+    this->chunk = chunk->prev;
+    this->stack_cur = chunk->prev_cur;
+    this->stack_end = chunk->prev_end;
+
+    if (this->chunk_spare == nullptr) {
+        this->chunk_spare = chunk;
+        return;
+    }
+
+    // Keep the biggest one
+    if (this->chunk_spare->size < chunk->size) {
+        auto *tmp = this->chunk_spare;
+
+        this->chunk_spare = chunk;
+        chunk = tmp;
+    }
+
+    ChunkRelease(chunk);
+}
+
 void Fiber::FrameDel(Frame *frame) {
     assert(((ArSize) this) == frame->fiber_id);
 
-    auto subtract = (unsigned long) (((unsigned char *) this->stack_cur) - ((unsigned char *) frame));
+    // Frames are released in LIFO order, if the frame is not in the current segment, the segments above it are empty.
+    // Segments are popped lazily: an empty chunk stays current until a frame below it is released
+    while (this->chunk != nullptr
+           && ((void *) frame < (void *) this->chunk->data || (void *) frame >= this->stack_end))
+        this->StackShrink();
 
-    assert(subtract < ((uintptr_t) this));
+    assert(this->chunk != nullptr || ((void *) frame >= (void *) this->stack_begin && (void *) frame < this->stack_end));
 
-    this->stack_cur = ((unsigned char *) this->stack_cur) - subtract;
+    this->stack_cur = frame;
 }
 
 Fiber *argon::vm::FiberNew(Context *context, unsigned int stack_space) {
@@ -64,9 +170,6 @@ Fiber *argon::vm::FiberNew(Context *context, unsigned int stack_space) {
 Frame *argon::vm::FrameNew(Fiber *fiber, Code *code, Namespace *globals, bool floating) {
     auto slots = code->stack_sz + code->sstack_sz + code->locals_sz;
 
-    if (!floating && fiber->frame != nullptr && fiber->frame->fiber_id == 0)
-        floating = true;
-
     auto *frame = fiber->FrameAlloc(slots, floating);
     if (frame == nullptr)
         return nullptr;
@@ -115,6 +218,8 @@ Frame *argon::vm::FrameNew(Fiber *fiber, Function *func, ArObject **argv, ArSize
     const Code *code = func->code;
     Dict *kwargs = nullptr;
     List *rest = nullptr;
+    Tuple *kw_names = nullptr;
+    ArObject **kw_values = nullptr;
 
     Frame *frame;
 
@@ -139,7 +244,14 @@ Frame *argon::vm::FrameNew(Fiber *fiber, Function *func, ArObject **argv, ArSize
     // Fill with stack args
     remains = func->arity - index_locals;
 
-    if (ENUMBITMASK_ISTRUE(mode, OpCodeCallMode::KW_PARAMS)) {
+    if (ENUMBITMASK_ISTRUE(mode, OpCodeCallMode::KW_NAMES)) {
+        // If mode == KW_NAMES, the last element is the tuple of names preceded by the values
+        kw_names = (Tuple *) argv[argc - 1];
+
+        argc -= kw_names->length + 1;
+
+        kw_values = argv + argc;
+    } else if (ENUMBITMASK_ISTRUE(mode, OpCodeCallMode::KW_PARAMS)) {
         // If mode == KW_PARAMS, the last element is the arguments dict
         kwargs = (Dict *) argv[argc - 1];
 
@@ -160,7 +272,9 @@ Frame *argon::vm::FrameNew(Fiber *fiber, Function *func, ArObject **argv, ArSize
         for (auto i = 0; i < func->default_args->length; i++) {
             ArObject *value = nullptr;
 
-            if (kwargs != nullptr)
+            if (kw_names != nullptr)
+                value = IncRef(KWArgsLookup(kw_names, kw_values, (String *) code->lnames->objects[index_locals]));
+            else if (kwargs != nullptr)
                 value = DictLookup(kwargs, code->lnames->objects[index_locals]);
 
             if (value != nullptr)
@@ -188,21 +302,84 @@ Frame *argon::vm::FrameNew(Fiber *fiber, Function *func, ArObject **argv, ArSize
     if (func->IsVariadic())
         frame->locals[index_locals++] = NilOrValue((ArObject *) rest);
 
-    if (func->IsKWArgs())
-        frame->locals[index_locals++] = NilOrValue(IncRef((ArObject *) kwargs));
+    if (func->IsKWArgs()) {
+        // The Dict is only built when the function actually asks for it
+        if (kw_names != nullptr) {
+            if ((kwargs = KWArgsToDict(kw_names, kw_values)) == nullptr) {
+                FrameDel(frame);
+                return nullptr;
+            }
+        } else
+            IncRef(kwargs);
+
+        frame->locals[index_locals++] = NilOrValue((ArObject *) kwargs);
+    }
 
     return frame;
 }
 
+Frame *argon::vm::FrameNewPlain(Fiber *fiber, Function *func, ArObject **argv) {
+    Frame *frame;
+
+    assert(func->IsPlain());
+
+    if ((frame = FrameNew(fiber, func->code, func->gns, IsPanicking())) == nullptr)
+        return nullptr;
+
+    for (unsigned short i = 0; i < func->arity; i++)
+        frame->locals[i] = argv[i];
+
+    frame->enclosed = IncRef(func->enclosed);
+
+    frame->base = (ArObject *) func->base;
+
+    return frame;
+}
+
+void argon::vm::FiberChunkCacheEnable() {
+    chunk_cache.enabled = true;
+}
+
+void argon::vm::FiberChunkCacheFlush() {
+    chunk_cache.enabled = false;
+
+    while (chunk_cache.head != nullptr) {
+        auto *chunk = chunk_cache.head;
+
+        chunk_cache.head = chunk->next;
+
+        memory::Free(chunk);
+    }
+
+    chunk_cache.count = 0;
+}
+
 void argon::vm::FiberDel(Fiber *fiber) {
     assert(fiber->frame == nullptr);
 
+    FiberResetStack(fiber);
+
     Release(fiber->future);
     Release(fiber->references);
 
     memory::Free(fiber);
 }
 
+void argon::vm::FiberResetStack(Fiber *fiber) {
+    assert(fiber->frame == nullptr);
+
+    while (fiber->chunk != nullptr)
+        fiber->StackShrink();
+
+    if (fiber->chunk_spare != nullptr) {
+        ChunkRelease(fiber->chunk_spare);
+        fiber->chunk_spare = nullptr;
+    }
+
+    fiber->chunk_size = 0;
+    fiber->stack_cur = fiber->stack_begin;
+}
+
 void argon::vm::FrameDel(Frame *frame) {
     const auto *code = frame->code;
     auto **locals_end = frame->locals;
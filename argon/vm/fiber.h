@@ -21,11 +21,45 @@
 
 namespace argon::vm::datatype {
     struct Future;
+    struct TaskGroup;
 }
 
 namespace argon::vm {
     constexpr const unsigned short kFiberStackSize = 1024; // 1KB
     constexpr const unsigned short kFiberPoolSize = 254; // Items
+    constexpr const unsigned short kFiberMagazineSize = 32; // Fibers cached by each OS thread
+    constexpr const unsigned int kFiberTimeSlice = 10000; // Backward jumps/calls before preemption
+    constexpr const unsigned int kFiberChunkSize = 8192; // 8KB
+    constexpr const unsigned int kFiberChunkSizeMax = 65536; // 64KB
+    constexpr const unsigned short kFiberChunkCacheMax = 32; // Chunks cached by each OS thread
+    constexpr const unsigned short kFiberPriorityCount = 3;
+
+    /// Scheduling class of a fiber, each class has its own global run queue (see FindExecutable).
+    enum class FiberPriority : unsigned char {
+        /// Latency-sensitive work (e.g. request handlers), runs before the other classes.
+        INTERACTIVE,
+        NORMAL,
+        /// Batch work, runs only when there is nothing else to do (or to prevent starvation).
+        BACKGROUND
+    };
+
+    /// Stack segment, chained to a fiber when its inline stack (see Fiber::stack_begin) is exhausted.
+    struct StackChunk {
+        /// Previous segment (nullptr = inline stack of the fiber).
+        StackChunk *prev;
+
+        /// Next free chunk (only used by the chunk cache).
+        StackChunk *next;
+
+        /// Values of stack_cur/stack_end of the previous segment when this chunk was pushed.
+        void *prev_cur;
+        void *prev_end;
+
+        /// Usable size of this chunk (in bytes).
+        unsigned int size;
+
+        void *data[];
+    };
 
     struct Fiber {
         /// Routine status.
@@ -50,6 +84,15 @@ namespace argon::vm {
 
         datatype::Future *future;
 
+        /// Task group this fiber belongs to (see SpawnGroup).
+        datatype::TaskGroup *group;
+
+        /// Index of the result of this fiber in the task group.
+        unsigned int group_index;
+
+        /// True until the scheduler runs the fiber for the first time (only set for task group fibers).
+        bool group_fresh;
+
         /// Stores object references of a function that may become recursive (e.g. list_repr, dict_repr...)
         datatype::List *references;
 
@@ -62,6 +105,25 @@ namespace argon::vm {
         /// Pointer to the frame allocated by the last EvalSync call.
         void *unwind_limit;
 
+        /// Scheduling class (new fibers inherit the class of the fiber that spawns them).
+        FiberPriority priority;
+
+        /// Backward jumps/calls left before the fiber is preempted (0 = not preemptible, see Scheduler).
+        unsigned int slice;
+
+        /// Time the fiber became runnable (nanoseconds, 0 = not tracked, see schedstats).
+        unsigned long long runnable_ns;
+
+        /// Current stack segment (nullptr = inline stack).
+        StackChunk *chunk;
+
+        /// Last popped segment, kept to avoid allocating a new chunk every time a call crosses the segment boundary.
+        StackChunk *chunk_spare;
+
+        /// Size of the first segment pushed when the inline stack is exhausted (0 = kFiberChunkSize),
+        /// the following segments double in size up to kFiberChunkSizeMax.
+        unsigned int chunk_size;
+
         void *stack_cur;
 
         void *stack_end;
@@ -71,6 +133,10 @@ namespace argon::vm {
         Frame *FrameAlloc(unsigned int size, bool floating);
 
         void FrameDel(Frame *frame);
+
+        bool StackGrow(unsigned long requested);
+
+        void StackShrink();
     };
 
     Fiber *FiberNew(Context *context, unsigned int stack_space);
@@ -80,6 +146,19 @@ namespace argon::vm {
     Frame *FrameNew(Fiber *fiber, datatype::Function *func, datatype::ArObject **argv, datatype::ArSize argc,
                     OpCodeCallMode mode);
 
+    /**
+     * @brief Create a new frame for a plain function (see Function::IsPlain).
+     *
+     * The first func->arity elements of argv are moved into the locals of the new frame,
+     * on success the caller MUST NOT release them.
+     *
+     * @param fiber Fiber that will execute the frame.
+     * @param func Plain function to call.
+     * @param argv Pointer to exactly func->arity arguments.
+     * @return A pointer to the new frame, otherwise nullptr.
+     */
+    Frame *FrameNewPlain(Fiber *fiber, datatype::Function *func, datatype::ArObject **argv);
+
     inline Frame *FiberPopFrame(Fiber *fiber) {
         auto *popped = fiber->frame;
         fiber->frame = popped->back;
@@ -94,6 +173,27 @@ namespace argon::vm {
 
     void FiberDel(Fiber *fiber);
 
+    /**
+     * @brief Release all the stack segments of a fiber (the fiber must not have any frame).
+     *
+     * The segments are returned to the chunk cache of the current OS thread.
+     *
+     * @param fiber Fiber whose stack should be reset.
+     */
+    void FiberResetStack(Fiber *fiber);
+
+    /**
+     * @brief Enable the stack chunk cache for the current OS thread.
+     *
+     * Without a cache, chunks are allocated and released directly with memory::Alloc/Free.
+     */
+    void FiberChunkCacheEnable();
+
+    /**
+     * @brief Release all the chunks in the cache of the current OS thread and disable it.
+     */
+    void FiberChunkCacheFlush();
+
     void FrameDel(Frame *frame);
 
     void FrameDelRec(Frame *frame);
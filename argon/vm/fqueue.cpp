@@ -23,6 +23,25 @@ Fiber *FiberQueue::Dequeue() {
     return ret;
 }
 
+unsigned int FiberQueue::Dequeue(Fiber **fibers, unsigned int max_items) {
+    std::unique_lock lock(this->lock_);
+
+    unsigned int count = 0;
+
+    while (count < max_items && this->head_ != nullptr) {
+        fibers[count++] = this->head_;
+
+        this->head_ = this->head_->rq.prev;
+    }
+
+    if (this->head_ == nullptr)
+        this->tail_ = nullptr;
+
+    this->items_ -= count;
+
+    return count;
+}
+
 Fiber *FiberQueue::StealDequeue(unsigned short min_len, argon::vm::FiberQueue &queue) {
     if (this->StealHalf(min_len, queue) > 0)
         return this->Dequeue();
@@ -36,7 +55,7 @@ bool FiberQueue::Enqueue(argon::vm::Fiber *fiber) {
 
     std::unique_lock lock(this->lock_);
 
-    if (this->max_ > 0 && (this->items_ + 1 >= this->max_))
+    if (this->max_ > 0 && (this->items_ + 1 > this->max_))
         return false;
 
     fiber->rq.next = this->tail_;
@@ -54,18 +73,48 @@ bool FiberQueue::Enqueue(argon::vm::Fiber *fiber) {
     return true;
 }
 
+bool FiberQueue::Enqueue(Fiber **fibers, unsigned int count) {
+    std::unique_lock lock(this->lock_);
+
+    if (this->max_ > 0 && (this->items_ + count > this->max_))
+        return false;
+
+    for (unsigned int i = 0; i < count; i++) {
+        auto *fiber = fibers[i];
+
+        fiber->rq.next = this->tail_;
+        fiber->rq.prev = nullptr;
+
+        if (this->tail_ == nullptr)
+            this->head_ = fiber;
+        else
+            this->tail_->rq.prev = fiber;
+
+        this->tail_ = fiber;
+    }
+
+    this->items_ += count;
+
+    return true;
+}
+
 bool FiberQueue::IsEmpty() {
     std::unique_lock lock(this->lock_);
     return this->items_ == 0;
 }
 
+unsigned int FiberQueue::Size() {
+    std::unique_lock lock(this->lock_);
+    return this->items_;
+}
+
 bool FiberQueue::InsertHead(argon::vm::Fiber *fiber) {
     if (fiber == nullptr)
         return true;
 
     std::unique_lock lock(this->lock_);
 
-    if (this->max_ > 0 && (this->items_ + 1 >= this->max_))
+    if (this->max_ > 0 && (this->items_ + 1 > this->max_))
         return false;
 
     if (this->head_ == nullptr) {
@@ -38,6 +38,15 @@ namespace argon::vm {
          */
         Fiber *Dequeue();
 
+        /**
+         * @brief Remove up to max_items fibers from the queue acquiring the lock only once.
+         *
+         * @param fibers Array that receives the removed fibers (in order).
+         * @param max_items Max number of fibers to remove.
+         * @return Number of removed fibers.
+         */
+        unsigned int Dequeue(Fiber **fibers, unsigned int max_items);
+
         /**
          * @brief Steal half of queued items from another queue.
          *
@@ -56,6 +65,16 @@ namespace argon::vm {
          */
         bool Enqueue(Fiber *fiber);
 
+        /**
+         * @brief Insert a batch of fibers into the queue acquiring the lock only once.
+         *
+         * @param fibers Array of fibers to insert (in order).
+         * @param count Number of fibers in the array.
+         * @return Returns true if all items have been added to the queue,
+         * otherwise false(the maximum number of items in the queue reached, nothing was added).
+         */
+        bool Enqueue(Fiber **fibers, unsigned int count);
+
         /**
          * @brief Check if queue is empty or not.
          *
@@ -63,6 +82,13 @@ namespace argon::vm {
          */
         bool IsEmpty();
 
+        /**
+         * @brief Get the number of fibers in the queue.
+         *
+         * @return Number of fibers (only a snapshot, the queue may change as soon as the lock is released).
+         */
+        unsigned int Size();
+
         /**
          * @brief Insert Fiber on the head of the queue.
          *
@@ -12,6 +12,8 @@
 
 #include <argon/vm/io/fio.h>
 
+#include <argon/vm/runtime.h>
+
 #ifdef _ARGON_PLATFORM_WINDOWS
 
 #include <io.h>
@@ -484,12 +486,19 @@ ArSSize argon::vm::io::WriteObjectStr(File *file, datatype::ArObject *object) {
 
 ArSSize argon::vm::io::Read(File *file, unsigned char *buf, datatype::ArSize count) {
     DWORD read;
+    BOOL ok;
+
+    EnterBlocking();
 
-    if (!ReadFile(file->handle,
+    ok = ReadFile(file->handle,
                   buf,
                   (DWORD) count,
                   &read,
-                  nullptr)) {
+                  nullptr);
+
+    LeaveBlocking();
+
+    if (!ok) {
         ErrorFromWinErr();
         return -1;
     }
@@ -499,12 +508,19 @@ ArSSize argon::vm::io::Read(File *file, unsigned char *buf, datatype::ArSize cou
 
 ArSSize argon::vm::io::Write(File *file, const unsigned char *buf, datatype::ArSize count) {
     DWORD written;
+    BOOL ok;
+
+    EnterBlocking();
 
-    if (!WriteFile(file->handle,
+    ok = WriteFile(file->handle,
                    buf,
                    (DWORD) count,
                    &written,
-                   nullptr)) {
+                   nullptr);
+
+    LeaveBlocking();
+
+    if (!ok) {
         ErrorFromWinErr();
         return -1;
     }
@@ -601,6 +617,9 @@ File *argon::vm::io::FileNew(const char *path, FileMode mode) {
     if (ENUMBITMASK_ISTRUE(mode, FileMode::APPEND))
         omode |= FILE_APPEND_DATA;
 
+    // Opening a file on a network share may block
+    EnterBlocking();
+
     auto handle = CreateFile(
             path,
             omode,
@@ -610,6 +629,8 @@ File *argon::vm::io::FileNew(const char *path, FileMode mode) {
             FILE_ATTRIBUTE_NORMAL,
             nullptr);
 
+    LeaveBlocking();
+
     if (handle == INVALID_HANDLE_VALUE) {
         ErrorFromWinErr();
         return nullptr;
@@ -665,7 +686,13 @@ File *argon::vm::io::FileNew(int fd, FileMode mode) {
 ArSSize argon::vm::io::Read(File *file, unsigned char *buf, datatype::ArSize count) {
     ArSSize rd;
 
-    if ((rd = read(file->handle, buf, count)) < 0) {
+    EnterBlocking();
+
+    rd = read(file->handle, buf, count);
+
+    LeaveBlocking();
+
+    if (rd < 0) {
         ErrorFromErrno(errno);
         return -1;
     }
@@ -676,7 +703,13 @@ ArSSize argon::vm::io::Read(File *file, unsigned char *buf, datatype::ArSize cou
 ArSSize argon::vm::io::Write(File *file, const unsigned char *buf, datatype::ArSize count) {
     ArSSize written;
 
-    if ((written = write(file->handle, buf, count)) < 0) {
+    EnterBlocking();
+
+    written = write(file->handle, buf, count);
+
+    LeaveBlocking();
+
+    if (written < 0) {
         ErrorFromErrno(errno);
         return -1;
     }
@@ -802,7 +835,14 @@ File *argon::vm::io::FileNew(const char *path, FileMode mode) {
     if (ENUMBITMASK_ISTRUE(mode, FileMode::APPEND))
         omode |= (unsigned int) O_APPEND;
 
-    if ((fd = open(path, (int) omode)) < 0) {
+    // Opening a FIFO or a file on a network filesystem may block
+    EnterBlocking();
+
+    fd = open(path, (int) omode);
+
+    LeaveBlocking();
+
+    if (fd < 0) {
         ErrorFromErrno(errno);
         return nullptr;
     }
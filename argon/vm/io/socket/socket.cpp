@@ -108,12 +108,7 @@ ARGON_METHOD(socket_detach, detach,
              "\n"
              "- Returns: File descriptor as UInt.\n",
              nullptr, false, false) {
-    auto *uint = UIntNew(0);
-
-    if (uint != nullptr)
-        uint->uint = Detach((Socket *) *args);
-
-    return (ArObject *) uint;
+    return (ArObject *) UIntNew(Detach((Socket *) *args));
 }
 
 ARGON_METHOD(socket_dup, dup,
@@ -175,18 +170,22 @@ ARGON_METHOD(socket_recv, recv,
              "- KWParameters:\n"
              "  - timeout: Maximum time(ms) to wait for incoming data on the socket.\n"
              "- Returns: Bytes object.\n",
-             "i: size, i: flags", false, true) {
+             "i: size, i: flags", false, kFunctionKWArgsView) {
     auto *self = (Socket *) _self;
     auto bufsize = ((Integer *) args[0])->sint;
 
-    auto timeout = (int) DictLookupInt((Dict *) kwargs, "timeout", 0);
+    IntegerUnderlying timeout;
+
+    if (!KParamLookupInt((Dict *) kwargs, "timeout", &timeout, 0))
+        return nullptr;
+
     if (timeout < 0)
         timeout = 0;
 
     if (bufsize < 0)
         ErrorFormat(kValueError[0], "size cannot be less than zero");
     else
-        Recv(self, bufsize, (int) ((Integer *) args[1])->sint, timeout);
+        Recv(self, bufsize, (int) ((Integer *) args[1])->sint, (int) timeout);
 
     return nullptr;
 }
@@ -200,18 +199,22 @@ ARGON_METHOD(socket_recvfrom, recvfrom,
              "- KWParameters:\n"
              "  - timeout: Maximum time(ms) to wait for incoming data on the socket.\n"
              "- Returns: Bytes object.\n",
-             "i: size, i: flags", false, true) {
+             "i: size, i: flags", false, kFunctionKWArgsView) {
     auto *self = (Socket *) _self;
     auto bufsize = ((Integer *) args[0])->sint;
 
-    auto timeout = (int) DictLookupInt((Dict *) kwargs, "timeout", 0);
+    IntegerUnderlying timeout;
+
+    if (!KParamLookupInt((Dict *) kwargs, "timeout", &timeout, 0))
+        return nullptr;
+
     if (timeout < 0)
         timeout = 0;
 
     if (bufsize < 0)
         ErrorFormat(kValueError[0], "size cannot be less than zero");
     else
-        RecvFrom(self, bufsize, (int) ((Integer *) args[1])->sint, timeout);
+        RecvFrom(self, bufsize, (int) ((Integer *) args[1])->sint, (int) timeout);
 
     return nullptr;
 }
@@ -225,14 +228,18 @@ ARGON_METHOD(socket_recvinto, recvinto,
              "- KWParameters:\n"
              "  - timeout: Maximum time(ms) to wait for incoming data on the socket.\n"
              "- Returns: Bytes object.\n",
-             ": obj, i: flags", false, true) {
+             ": obj, i: flags", false, kFunctionKWArgsView) {
     auto *self = (Socket *) _self;
 
-    auto timeout = (int) DictLookupInt((Dict *) kwargs, "timeout", 0);
+    IntegerUnderlying timeout;
+
+    if (!KParamLookupInt((Dict *) kwargs, "timeout", &timeout, 0))
+        return nullptr;
+
     if (timeout < 0)
         timeout = 0;
 
-    RecvInto(self, args[0], 0, (int) ((Integer *) args[1])->sint, timeout);
+    RecvInto(self, args[0], 0, (int) ((Integer *) args[1])->sint, (int) timeout);
 
     return nullptr;
 }
@@ -247,13 +254,17 @@ ARGON_METHOD(socket_send, send,
              "- KWParameters:\n"
              "  - timeout: Maximum time(ms) allowed for data transmission over the socket.\n"
              "- Returns: Bytes sent.\n",
-             ": obj, i: nbytes, i: flags", false, true) {
+             ": obj, i: nbytes, i: flags", false, kFunctionKWArgsView) {
     auto *self = (Socket *) _self;
-    auto timeout = (int) DictLookupInt((Dict *) kwargs, "timeout", 0);
+    IntegerUnderlying timeout;
+
+    if (!KParamLookupInt((Dict *) kwargs, "timeout", &timeout, 0))
+        return nullptr;
+
     if (timeout < 0)
         timeout = 0;
 
-    Send(self, *args, ((Integer *) args[2])->sint, (int) ((Integer *) args[2])->sint, timeout);
+    Send(self, *args, ((Integer *) args[2])->sint, (int) ((Integer *) args[2])->sint, (int) timeout);
 
     return nullptr;
 }
@@ -269,13 +280,17 @@ ARGON_METHOD(socket_sendto, sendto,
              "- KWParameters:\n"
              "  - timeout: Maximum time(ms) allowed for data transmission over the socket.\n"
              "- Returns: Bytes sent.\n",
-             " : dest, : obj, i: nbytes, i: flags", false, true) {
+             " : dest, : obj, i: nbytes, i: flags", false, kFunctionKWArgsView) {
     auto *self = (Socket *) _self;
-    auto timeout = (int) DictLookupInt((Dict *) kwargs, "timeout", 0);
+    IntegerUnderlying timeout;
+
+    if (!KParamLookupInt((Dict *) kwargs, "timeout", &timeout, 0))
+        return nullptr;
+
     if (timeout < 0)
         timeout = 0;
 
-    SendTo(self, args[0], args[1], ((Integer *) args[2])->sint, (int) ((Integer *) args[3])->sint, timeout);
+    SendTo(self, args[0], args[1], ((Integer *) args[2])->sint, (int) ((Integer *) args[3])->sint, (int) timeout);
 
     return nullptr;
 }
@@ -0,0 +1,651 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+
+#ifdef ARGON_FF_JIT
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#endif
+
+#include <argon/vm/memory/gc.h>
+#include <argon/vm/memory/memory.h>
+
+#include <argon/vm/datatype/boolean.h>
+#include <argon/vm/datatype/error.h>
+#include <argon/vm/datatype/integer.h>
+
+#include <argon/vm/areval.h>
+#include <argon/vm/opcode.h>
+#include <argon/vm/profiler.h>
+#include <argon/vm/runtime.h>
+
+#include <argon/vm/jit.h>
+
+using namespace argon::vm;
+using namespace argon::vm::datatype;
+using namespace argon::vm::jit;
+
+unsigned int argon::vm::jit::jit_threshold = 0;
+
+#ifdef ARGON_FF_JIT
+
+// Helpers return kHelperNext to go on with the next instruction, a JITStatus to leave the machine code
+// or (conditional jumps only) kHelperJump if the jump is taken
+constexpr int kHelperNext = (int) JITStatus::NONE;
+constexpr int kHelperJump = 16;
+
+using JITHelper = int (*)(Fiber *, Frame *, const unsigned char *);
+
+// *** HELPERS ***
+// Each helper executes one instruction on the frame exactly as Eval does, the machine code is only a sequence of
+// helper calls. On panic the helper leaves frame->instr_ptr on the faulting instruction and returns BREAK
+
+#define PEEK1() (*(frame->eval_stack - 2))
+#define TOP()   (*(frame->eval_stack - 1))
+
+#define POP()   Release(*(--frame->eval_stack))
+
+#define PUSH(obj) do {              \
+    *frame->eval_stack = obj;       \
+    frame->eval_stack++;            \
+    } while(0)
+
+#define TOP_REPLACE(obj) do {               \
+    Release(*(frame->eval_stack - 1));      \
+    *(frame->eval_stack - 1) = obj;         \
+    } while(0)
+
+#define HELPER_PANIC() do {                                     \
+    frame->instr_ptr = (unsigned char *) ip;                    \
+    return (int) JITStatus::BREAK;                              \
+    } while(0)
+
+int HelperLDLC(Fiber *, Frame *frame, const unsigned char *ip) {
+    PUSH(IncRef(frame->locals[I16Arg(ip)]));
+    return kHelperNext;
+}
+
+int HelperLDLC_LDLC(Fiber *, Frame *frame, const unsigned char *ip) {
+    PUSH(IncRef(frame->locals[I16Arg(ip)]));
+    PUSH(IncRef(frame->locals[I16Arg(ip + 2)]));
+    return kHelperNext;
+}
+
+int HelperSTLC(Fiber *, Frame *frame, const unsigned char *ip) {
+    auto idx = I16Arg(ip);
+
+    Release(frame->locals[idx]);
+    frame->locals[idx] = TOP();
+    frame->eval_stack--;
+
+    return kHelperNext;
+}
+
+int HelperLSTATIC(Fiber *, Frame *frame, const unsigned char *ip) {
+    PUSH(TupleGet(frame->code->statics, I32Arg(ip)));
+    return kHelperNext;
+}
+
+int HelperPOP(Fiber *, Frame *frame, const unsigned char *) {
+    POP();
+    return kHelperNext;
+}
+
+int HelperPSHN(Fiber *, Frame *frame, const unsigned char *) {
+    PUSH(nullptr);
+    return kHelperNext;
+}
+
+int HelperDUP(Fiber *, Frame *frame, const unsigned char *ip) {
+    auto items = I16Arg(ip);
+    auto **cursor = frame->eval_stack - items;
+
+    while (items--)
+        PUSH(IncRef(*(cursor++)));
+
+    return kHelperNext;
+}
+
+int ExecBinary(Frame *frame, const unsigned char *ip, int offset, const char *opchar) {
+    ArObject *ret;
+
+    if ((ret = ExecBinaryOp(PEEK1(), TOP(), offset)) == nullptr) {
+        if (!IsPanickingFrame())
+            ErrorFormat(kRuntimeError[0], kRuntimeError[2], opchar, AR_TYPE_NAME(PEEK1()), AR_TYPE_NAME(TOP()));
+
+        HELPER_PANIC();
+    }
+
+    POP();
+    TOP_REPLACE(ret);
+
+    return kHelperNext;
+}
+
+#define INT_BINARY_HELPER(name, op, slot, opchar)                                                           \
+int Helper##name(Fiber *, Frame *frame, const unsigned char *ip) {                                          \
+    ArObject *ret;                                                                                          \
+    if (!AR_TYPEOF(PEEK1(), type_int_) || !AR_TYPEOF(TOP(), type_int_))                                     \
+        return ExecBinary(frame, ip, offsetof(OpSlots, slot), opchar);                                      \
+    if ((ret = (ArObject *) IntNew(((Integer *) PEEK1())->sint op ((Integer *) TOP())->sint)) == nullptr)   \
+        HELPER_PANIC();                                                                                     \
+    POP();                                                                                                  \
+    TOP_REPLACE(ret);                                                                                       \
+    return kHelperNext;                                                                                     \
+}
+
+#define BINARY_HELPER(name, slot, opchar)                                                                   \
+int Helper##name(Fiber *, Frame *frame, const unsigned char *ip) {                                          \
+    return ExecBinary(frame, ip, offsetof(OpSlots, slot), opchar);                                          \
+}
+
+INT_BINARY_HELPER(ADD, +, add, "+")
+
+INT_BINARY_HELPER(SUB, -, sub, "-")
+
+INT_BINARY_HELPER(MUL, *, mul, "*")
+
+BINARY_HELPER(DIV, div, "/")
+
+BINARY_HELPER(IDIV, idiv, "'//'")
+
+BINARY_HELPER(MOD, mod, "%")
+
+int ExecUnary(Frame *frame, const unsigned char *ip, int offset, const char *opchar) {
+    auto *ret = TOP();
+    auto *ops = AR_GET_TYPE(ret)->ops;
+    UnaryOp op;
+
+    if (ops == nullptr || (op = *((const UnaryOp *) (((const unsigned char *) ops) + offset))) == nullptr) {
+        ErrorFormat(kRuntimeError[0], kRuntimeError[1], opchar, AR_TYPE_NAME(ret));
+        HELPER_PANIC();
+    }
+
+    if ((ret = op(ret)) == nullptr)
+        HELPER_PANIC();
+
+    TOP_REPLACE(ret);
+
+    return kHelperNext;
+}
+
+#define INT_UNARY_HELPER(name, op, slot, opchar)                                                            \
+int Helper##name(Fiber *, Frame *frame, const unsigned char *ip) {                                          \
+    ArObject *ret;                                                                                          \
+    if (!AR_TYPEOF(TOP(), type_int_))                                                                       \
+        return ExecUnary(frame, ip, offsetof(OpSlots, slot), opchar);                                       \
+    if ((ret = (ArObject *) IntNew(((Integer *) TOP())->sint op 1)) == nullptr)                             \
+        HELPER_PANIC();                                                                                     \
+    TOP_REPLACE(ret);                                                                                       \
+    return kHelperNext;                                                                                     \
+}
+
+INT_UNARY_HELPER(INC, +, inc, "++")
+
+INT_UNARY_HELPER(DEC, -, dec, "--")
+
+int HelperNEG(Fiber *, Frame *frame, const unsigned char *ip) {
+    return ExecUnary(frame, ip, offsetof(OpSlots, neg), "-");
+}
+
+int HelperNOT(Fiber *, Frame *frame, const unsigned char *) {
+    TOP_REPLACE(BoolToArBool(!IsTrue(TOP())));
+    return kHelperNext;
+}
+
+int HelperCMP(Fiber *, Frame *frame, const unsigned char *ip) {
+    auto mode = (CompareMode) I16Arg(ip);
+    ArObject *ret;
+
+    if (AR_TYPEOF(PEEK1(), type_int_) && AR_TYPEOF(TOP(), type_int_))
+        ret = BoolToArBool(CompareInt(((Integer *) PEEK1())->sint, ((Integer *) TOP())->sint, mode));
+    else if ((ret = Compare(PEEK1(), TOP(), mode)) == nullptr)
+        HELPER_PANIC();
+
+    POP();
+    TOP_REPLACE(ret);
+
+    return kHelperNext;
+}
+
+int HelperCMP_JF(Fiber *, Frame *frame, const unsigned char *ip) {
+    auto mode = (CompareMode) I16Arg(ip);
+    bool result;
+
+    if (AR_TYPEOF(PEEK1(), type_int_) && AR_TYPEOF(TOP(), type_int_))
+        result = CompareInt(((Integer *) PEEK1())->sint, ((Integer *) TOP())->sint, mode);
+    else {
+        ArObject *ret;
+
+        if ((ret = Compare(PEEK1(), TOP(), mode)) == nullptr)
+            HELPER_PANIC();
+
+        result = IsTrue(ret);
+
+        Release(ret);
+    }
+
+    POP();
+    POP();
+
+    return result ? kHelperNext : kHelperJump;
+}
+
+int HelperJF(Fiber *, Frame *frame, const unsigned char *) {
+    bool result = IsTrue(TOP());
+
+    POP();
+
+    return result ? kHelperNext : kHelperJump;
+}
+
+int HelperJT(Fiber *, Frame *frame, const unsigned char *) {
+    bool result = IsTrue(TOP());
+
+    POP();
+
+    return result ? kHelperJump : kHelperNext;
+}
+
+// Backward jump, the same safe point of Eval (see PREEMPTION_POINT), ip points to the jump target
+int HelperLoop(Fiber *fiber, Frame *frame, const unsigned char *ip) {
+    if (fiber->unwind_limit != nullptr)
+        return kHelperNext;
+
+    if (memory::GCSafePointRequested()) {
+        frame->instr_ptr = (unsigned char *) ip;
+
+        memory::GCSafePoint();
+
+        if (IsPanickingFrame())
+            return (int) JITStatus::BREAK;
+    }
+
+    if (fiber->slice > 0 && --fiber->slice == 0) {
+        frame->instr_ptr = (unsigned char *) ip;
+
+        SetFiberStatus(FiberStatus::SUSPENDED);
+
+        return (int) JITStatus::SUSPEND;
+    }
+
+    return kHelperNext;
+}
+
+int HelperRET(Fiber *, Frame *frame, const unsigned char *ip) {
+    frame->return_value = TOP();
+    frame->eval_stack--;
+    frame->instr_ptr = (unsigned char *) ip + 1;
+
+    return (int) JITStatus::BREAK;
+}
+
+#undef PEEK1
+#undef TOP
+#undef POP
+#undef PUSH
+#undef TOP_REPLACE
+#undef HELPER_PANIC
+
+// *** X86-64 CODE GENERATION ***
+// Native frame: rbx = fiber, r12 = frame (r13 is saved only to keep the stack aligned to 16 bytes)
+
+struct Emitter {
+    /// Output buffer (nullptr during the sizing pass).
+    unsigned char *buffer;
+
+    /// Current position.
+    ArSize pos;
+
+    void Byte(unsigned char byte) {
+        if (this->buffer != nullptr)
+            this->buffer[this->pos] = byte;
+
+        this->pos++;
+    }
+
+    void Bytes(std::initializer_list<unsigned char> bytes) {
+        for (auto byte: bytes)
+            this->Byte(byte);
+    }
+
+    void U32(std::uint32_t value) {
+        for (int i = 0; i < 4; i++)
+            this->Byte((unsigned char) (value >> (i * 8)));
+    }
+
+    void U64(std::uint64_t value) {
+        for (int i = 0; i < 8; i++)
+            this->Byte((unsigned char) (value >> (i * 8)));
+    }
+
+    // rel32 is relative to the end of the instruction (this->pos + 4)
+    void Rel32(ArSize target) {
+        this->U32((std::uint32_t) (std::int32_t) ((std::int64_t) target - (std::int64_t) (this->pos + 4)));
+    }
+};
+
+void EmitPrologue(Emitter *em) {
+    em->Bytes({0x53});              // push rbx
+    em->Bytes({0x41, 0x54});        // push r12
+    em->Bytes({0x41, 0x55});        // push r13
+    em->Bytes({0x48, 0x89, 0xFB});  // mov rbx, rdi
+    em->Bytes({0x49, 0x89, 0xF4});  // mov r12, rsi
+    em->Bytes({0xFF, 0xE2});        // jmp rdx
+}
+
+void EmitEpilogue(Emitter *em) {
+    em->Bytes({0x41, 0x5D});        // pop r13
+    em->Bytes({0x41, 0x5C});        // pop r12
+    em->Bytes({0x5B});              // pop rbx
+    em->Bytes({0xC3});              // ret
+}
+
+void EmitCall(Emitter *em, JITHelper helper, const unsigned char *ip) {
+    em->Bytes({0x48, 0x89, 0xDF});  // mov rdi, rbx
+    em->Bytes({0x4C, 0x89, 0xE6});  // mov rsi, r12
+    em->Bytes({0x48, 0xBA});        // mov rdx, imm64
+    em->U64((std::uint64_t) ip);
+    em->Bytes({0x48, 0xB8});        // mov rax, imm64
+    em->U64((std::uint64_t) helper);
+    em->Bytes({0xFF, 0xD0});        // call rax
+}
+
+// Leave the machine code if the helper did not return kHelperNext
+void EmitCheck(Emitter *em, ArSize exit) {
+    em->Bytes({0x85, 0xC0});        // test eax, eax
+    em->Bytes({0x0F, 0x85});        // jnz exit
+    em->Rel32(exit);
+}
+
+void EmitCondJump(Emitter *em, ArSize target, ArSize exit) {
+    em->Bytes({0x85, 0xC0});        // test eax, eax
+    em->Bytes({0x74, 0x0E});        // jz next
+    em->Bytes({0x83, 0xF8, kHelperJump}); // cmp eax, kHelperJump
+    em->Bytes({0x0F, 0x84});        // je target
+    em->Rel32(target);
+    em->Bytes({0xE9});              // jmp exit
+    em->Rel32(exit);
+}
+
+void EmitJump(Emitter *em, ArSize target) {
+    em->Bytes({0xE9});              // jmp target
+    em->Rel32(target);
+}
+
+// Let Eval resume from ip
+void EmitBail(Emitter *em, const unsigned char *ip, ArSize exit) {
+    em->Bytes({0x48, 0xB8});        // mov rax, imm64
+    em->U64((std::uint64_t) ip);
+    em->Bytes({0x49, 0x89, 0x84, 0x24}); // mov [r12 + disp32], rax
+    em->U32(offsetof(Frame, instr_ptr));
+    em->Bytes({0xB8});              // mov eax, imm32
+    em->U32((std::uint32_t) JITStatus::BAIL);
+    em->Bytes({0xE9});              // jmp exit
+    em->Rel32(exit);
+}
+
+JITHelper GetHelper(OpCode op) {
+    switch (op) {
+        case OpCode::ADD:
+        case OpCode::ADD_INT_INT:
+            return HelperADD;
+        case OpCode::DEC:
+            return HelperDEC;
+        case OpCode::DIV:
+            return HelperDIV;
+        case OpCode::DUP:
+            return HelperDUP;
+        case OpCode::IDIV:
+            return HelperIDIV;
+        case OpCode::INC:
+            return HelperINC;
+        case OpCode::LDLC:
+            return HelperLDLC;
+        case OpCode::LDLC_LDLC:
+            return HelperLDLC_LDLC;
+        case OpCode::LSTATIC:
+            return HelperLSTATIC;
+        case OpCode::MOD:
+            return HelperMOD;
+        case OpCode::MUL:
+        case OpCode::MUL_INT_INT:
+            return HelperMUL;
+        case OpCode::NEG:
+            return HelperNEG;
+        case OpCode::NOT:
+            return HelperNOT;
+        case OpCode::POP:
+            return HelperPOP;
+        case OpCode::PSHN:
+            return HelperPSHN;
+        case OpCode::STLC:
+            return HelperSTLC;
+        case OpCode::SUB:
+        case OpCode::SUB_INT_INT:
+            return HelperSUB;
+        default:
+            return nullptr;
+    }
+}
+
+// offsets: native offset of each instruction (indexed by bytecode offset, valid only in the second pass)
+void EmitCode(Emitter *em, const Code *code, ArSize *offsets) {
+    const unsigned char *ip = code->instr;
+    ArSize exit;
+
+    EmitPrologue(em);
+
+    exit = em->pos;
+    EmitEpilogue(em);
+
+    while (ip < code->instr_end) {
+        auto op = LoadOpCode(ip);
+        auto offset = (ArSize) (ip - code->instr);
+        JITHelper helper;
+
+        offsets[offset] = em->pos;
+
+        if ((helper = GetHelper(op)) != nullptr) {
+            EmitCall(em, helper, ip);
+            EmitCheck(em, exit);
+
+            // The second instruction of a superinstruction is translated too (it may be a jump target), skip it
+            if (op == OpCode::LDLC_LDLC)
+                EmitJump(em, offsets[offset + 4]);
+
+            ip += OpCodeOffset[(unsigned char) op];
+            continue;
+        }
+
+        switch (op) {
+            case OpCode::CMP:
+            case OpCode::CMP_INT_INT:
+                EmitCall(em, HelperCMP, ip);
+                EmitCheck(em, exit);
+                break;
+            case OpCode::CMP_JF:
+                // CMP (2 bytes) fused with the following JF (4 bytes)
+                EmitCall(em, HelperCMP_JF, ip);
+                EmitCondJump(em, offsets[I32Arg(ip + 2)], exit);
+                EmitJump(em, offsets[offset + 6]);
+                break;
+            case OpCode::JF:
+                EmitCall(em, HelperJF, ip);
+                EmitCondJump(em, offsets[I32Arg(ip)], exit);
+                break;
+            case OpCode::JT:
+                EmitCall(em, HelperJT, ip);
+                EmitCondJump(em, offsets[I32Arg(ip)], exit);
+                break;
+            case OpCode::JMP:
+                if (I32Arg(ip) <= offset) {
+                    EmitCall(em, HelperLoop, code->instr + I32Arg(ip));
+                    EmitCheck(em, exit);
+                }
+
+                EmitJump(em, offsets[I32Arg(ip)]);
+                break;
+            case OpCode::RET:
+                EmitCall(em, HelperRET, ip);
+                EmitJump(em, exit);
+                break;
+            default:
+                EmitBail(em, ip, exit);
+                break;
+        }
+
+        ip += OpCodeOffset[(unsigned char) op];
+    }
+
+    // A jump to the end of the code, Eval terminates the frame
+    offsets[code->instr_sz] = em->pos;
+    EmitBail(em, code->instr_end, exit);
+}
+
+JITCode *Translate(const Code *code) {
+    Emitter em{};
+    JITCode *jc;
+    ArSize *offsets;
+    ArSize page_sz;
+
+    if ((offsets = (ArSize *) memory::Calloc((code->instr_sz + 1) * sizeof(ArSize))) == nullptr)
+        return nullptr;
+
+    // First pass: every instruction has a fixed size, compute the native offsets (and the total size)
+    EmitCode(&em, code, offsets);
+
+    if ((jc = (JITCode *) memory::Alloc(sizeof(JITCode))) == nullptr) {
+        memory::Free(offsets);
+        return nullptr;
+    }
+
+    if ((jc->entries = (const void **) memory::Calloc((code->instr_sz + 1) * sizeof(void *))) == nullptr) {
+        memory::Free(offsets);
+        memory::Free(jc);
+        return nullptr;
+    }
+
+    page_sz = (ArSize) sysconf(_SC_PAGESIZE);
+
+    jc->buffer_sz = (em.pos + page_sz - 1) & ~(page_sz - 1);
+
+    jc->buffer = mmap(nullptr, jc->buffer_sz, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (jc->buffer == MAP_FAILED) {
+        memory::Free(offsets);
+        memory::Free(jc->entries);
+        memory::Free(jc);
+        return nullptr;
+    }
+
+    // Second pass: emit
+    em.buffer = (unsigned char *) jc->buffer;
+    em.pos = 0;
+
+    EmitCode(&em, code, offsets);
+
+    // W^X: the buffer is never writable and executable at the same time
+    if (mprotect(jc->buffer, jc->buffer_sz, PROT_READ | PROT_EXEC) != 0) {
+        munmap(jc->buffer, jc->buffer_sz);
+
+        memory::Free(offsets);
+        memory::Free(jc->entries);
+        memory::Free(jc);
+        return nullptr;
+    }
+
+    // Only the beginning of each instruction is a valid entry point
+    for (const unsigned char *ip = code->instr; ip < code->instr_end;
+         ip += OpCodeOffset[(unsigned char) LoadOpCode(ip)])
+        jc->entries[ip - code->instr] = em.buffer + offsets[ip - code->instr];
+
+    jc->fn = (JITStatus (*)(Fiber *, Frame *, const void *)) jc->buffer;
+
+    memory::Free(offsets);
+
+    return jc;
+}
+
+bool Compile(Code *code) {
+    unsigned char expected = kJITCold;
+    JITCode *jc;
+
+    // Only one fiber compiles the code, the others go on interpreting it
+    if (!code->jit_state.compare_exchange_strong(expected, kJITCompiling, std::memory_order_acq_rel))
+        return false;
+
+    if ((jc = Translate(code)) == nullptr) {
+        DiscardLastPanic();
+
+        code->jit_state.store(kJITFailed, std::memory_order_release);
+        return false;
+    }
+
+    code->jit = jc;
+    code->jit_state.store(kJITCompiled, std::memory_order_release);
+
+    return true;
+}
+
+#endif
+
+bool argon::vm::jit::IsAvailable() {
+#ifdef ARGON_FF_JIT
+    return true;
+#else
+    return false;
+#endif
+}
+
+JITStatus argon::vm::jit::Enter(Fiber *fiber, Frame *frame) {
+#ifdef ARGON_FF_JIT
+    auto *code = frame->code;
+    const void *entry;
+
+    if (code->jit_state.load(std::memory_order_acquire) != kJITCompiled) {
+        // Lost updates between threads only delay the compilation
+        auto *hotness = (std::atomic<unsigned int> *) &code->jit_hotness;
+        auto count = hotness->load(std::memory_order_relaxed) + 1;
+
+        hotness->store(count, std::memory_order_relaxed);
+
+        if (count < jit_threshold || !Compile(code))
+            return JITStatus::NONE;
+    }
+
+#ifdef ARGON_FF_PROFILER
+    // The profiler counts the instructions dispatched by Eval
+    if (profiler::IsEnabled())
+        return JITStatus::NONE;
+#endif
+
+    if ((entry = code->jit->entries[frame->instr_ptr - code->instr]) == nullptr)
+        return JITStatus::NONE;
+
+    return code->jit->fn(fiber, frame, entry);
+#else
+    return JITStatus::NONE;
+#endif
+}
+
+void argon::vm::jit::Release(Code *code) {
+#ifdef ARGON_FF_JIT
+    auto *jc = code->jit;
+
+    if (jc == nullptr)
+        return;
+
+    munmap(jc->buffer, jc->buffer_sz);
+
+    memory::Free(jc->entries);
+    memory::Free(jc);
+
+    code->jit = nullptr;
+#endif
+}
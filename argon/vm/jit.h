@@ -0,0 +1,85 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#ifndef ARGON_VM_JIT_H_
+#define ARGON_VM_JIT_H_
+
+#include <argon/vm/datatype/code.h>
+
+#include <argon/vm/fiber.h>
+#include <argon/vm/frame.h>
+
+namespace argon::vm::jit {
+    /// Calls and backward jumps of a Code object before it is compiled (--jit, see Config::jit).
+    constexpr unsigned int kJITDefaultThreshold = 1000;
+
+    enum class JITStatus : int {
+        /// Code not compiled (or not yet hot), Eval goes on interpreting from frame->instr_ptr.
+        NONE,
+
+        /// The machine code reached an instruction it does not translate, Eval resumes from frame->instr_ptr.
+        BAIL,
+
+        /// The frame returned or is panicking, Eval must proceed as if the instruction ended with a break.
+        BREAK,
+
+        /// The fiber was suspended (time slice exhausted), Eval must return.
+        SUSPEND
+    };
+
+    /// Machine code of a Code object.
+    struct JITCode {
+        /// Entry point: JITStatus fn(Fiber *fiber, Frame *frame, const void *entry).
+        JITStatus (*fn)(Fiber *, Frame *, const void *);
+
+        /// Native address of each instruction (indexed by bytecode offset, nullptr inside an instruction).
+        const void **entries;
+
+        /// Executable memory that contains fn.
+        void *buffer;
+
+        datatype::ArSize buffer_sz;
+    };
+
+    /// Number of calls/backward jumps before compiling a Code (0: JIT disabled).
+    extern unsigned int jit_threshold;
+
+    /**
+     * @brief Check if the JIT was compiled in (see ARGON_FF_JIT, x86-64 Linux only).
+     *
+     * @return True if the JIT is available, false otherwise.
+     */
+    bool IsAvailable();
+
+    /**
+     * @brief Check if the JIT is enabled (--jit / ARGON_JIT).
+     *
+     * @return True if hot code objects are compiled, false otherwise.
+     */
+    inline bool IsEnabled() {
+        return jit_threshold > 0;
+    }
+
+    /**
+     * @brief Counts a call/backward jump of frame->code and runs its machine code from frame->instr_ptr.
+     *
+     * The code is compiled when it becomes hot. The machine code translates each instruction into a call to a
+     * helper that works on the frame exactly like Eval, so Eval can always resume from frame->instr_ptr.
+     *
+     * @param fiber Pointer to the running fiber.
+     * @param frame Pointer to the frame that is being executed.
+     * @return What Eval must do next (see JITStatus).
+     */
+    JITStatus Enter(Fiber *fiber, Frame *frame);
+
+    /**
+     * @brief Release the machine code of a Code object (called by the Code destructor).
+     *
+     * @param code Pointer to Code object.
+     */
+    void Release(datatype::Code *code);
+
+} // namespace argon::vm::jit
+
+#endif // !ARGON_VM_JIT_H_
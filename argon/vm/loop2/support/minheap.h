@@ -224,7 +224,10 @@ namespace argon::vm::loop2::support {
                 path >>= 1;
             }
 
+            // The node may come from a free list that reuses its links, a new leaf has no children
             t->heap.parent = parent;
+            t->heap.left = nullptr;
+            t->heap.right = nullptr;
             *current = t;
 
             this->nitems++;
@@ -52,8 +52,12 @@ namespace argon::vm::memory {
         static const unsigned char FinalizedBits = 1;
         static const uintptr_t FinalizedMask = Mask(Finalized);
 
-        static const unsigned char AddressShift = After(Finalized);
-        static const unsigned char AddressBits = CounterBits(Finalized);
+        static const unsigned char YoungShift = After(Finalized);
+        static const unsigned char YoungBits = 1;
+        static const uintptr_t YoungMask = Mask(Young);
+
+        static const unsigned char AddressShift = After(Young);
+        static const unsigned char AddressBits = CounterBits(Young);
         static const uintptr_t AddressMask = Mask(Address);
     };
 
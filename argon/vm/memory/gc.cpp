@@ -2,13 +2,44 @@
 //
 // Licensed under the Apache License v2.0
 
+#include <condition_variable>
+#include <thread>
+
+#include <argon/vm/runtime.h>
+
 #include <argon/vm/datatype/arobject.h>
 
 #include <argon/vm/memory/gc.h>
+#include <argon/vm/memory/heapprof.h>
 
 using namespace argon::vm::datatype;
 using namespace argon::vm::memory;
 
+// Objects tracked by an OS thread since the last collection, they are merged
+// into the first generation by the collector (see MergeYoungLists)
+struct YoungList {
+    std::mutex lock;
+
+    GCHead *list;
+
+    YoungList *next;
+
+    /// Objects in list.
+    ArSize count;
+
+    /// Allocations not yet added to the global counter (see kGCYoungBatch).
+    unsigned int unpublished;
+
+    /// The owner thread is gone, the collector releases this list after merging it.
+    bool orphan;
+};
+
+constexpr unsigned int kGCYoungBatch = 32;
+
+/// Allocations (as a multiple of the first generation threshold) that a running collection can fall behind
+/// before the allocating fibers wait for it (see ThresholdCollect).
+constexpr unsigned int kGCDebtLimit = 4;
+
 // GC variables
 GCGeneration generations[kGCGenerations] = {   // Generation queues
         {nullptr, 0, 0, 0, 550, 0},
@@ -17,17 +48,33 @@ GCGeneration generations[kGCGenerations] = {   // Generation queues
 };
 
 GCHead *garbage = nullptr;      // Pointer to list of objects ready to be deleted
+std::atomic_bool sweep_pending = false;
+
+std::atomic_bool argon::vm::memory::gc_safepoint = false;
 
 ArSize total_tracked = 0;       // Sum of the objects tracked in each generation
-ArSize allocations = 0;
+std::atomic<ArSize> allocations = 0;
 ArSize deallocations = 0;
 
 std::mutex track_lock;          // GC lock
 std::mutex garbage_lock;        // Garbage lock
 
+YoungList *young_lists = nullptr;
+std::mutex young_lock;          // Protects young_lists (not the lists content)
+
+thread_local YoungList *young_local = nullptr;
+
 std::atomic_bool enabled = true;
 std::atomic_bool gc_requested = false;
 
+// Background collector (see GCStartCollector)
+std::thread collector;
+std::condition_variable collector_cond;
+std::condition_variable collector_done;
+std::mutex collector_lock;
+bool collector_stop = false;
+std::atomic_bool collector_running = false;
+
 // Prototypes
 inline void InitGCRefCount(GCHead *, const argon::vm::datatype::ArObject *);
 
@@ -57,7 +104,8 @@ void GCHeadRemove(GCHead *head) {
 void GCDecRef(argon::vm::datatype::ArObject *object) {
     GCHead *head = GCGetHead(object);
 
-    if (head == nullptr || !head->IsTracked())
+    // Young objects are outside the collection, their owner thread may be inserting new objects next to them
+    if (head == nullptr || !head->IsTracked() || head->IsYoung())
         return;
 
     if (!head->IsVisited())
@@ -69,7 +117,7 @@ void GCDecRef(argon::vm::datatype::ArObject *object) {
 void GCIncRef(argon::vm::datatype::ArObject *object) {
     GCHead *head = GCGetHead(object);
 
-    if (head == nullptr || !head->IsTracked())
+    if (head == nullptr || !head->IsTracked() || head->IsYoung())
         return;
 
     if (head->IsVisited()) {
@@ -85,6 +133,169 @@ inline void InitGCRefCount(GCHead *head, const argon::vm::datatype::ArObject *ob
     head->SetVisited(true);
 }
 
+bool ClaimHead(GCHead *head) {
+    static_assert(sizeof(std::atomic<uintptr_t>) == sizeof(GCHead *));
+
+    // An untracked head has no links and no flags, the first thread that sets the Young bit tracks the object
+    uintptr_t expected = 0;
+
+    return ((std::atomic<uintptr_t> *) &head->next)->compare_exchange_strong(expected, GCBitOffsets::YoungMask,
+                                                                             std::memory_order_acq_rel,
+                                                                             std::memory_order_relaxed);
+}
+
+YoungList *GetYoungList() {
+    if (young_local != nullptr)
+        return young_local;
+
+    // No panic on failure, the caller falls back to the first generation
+    auto *young = (YoungList *) stratum::Alloc(sizeof(YoungList));
+    if (young == nullptr)
+        return nullptr;
+
+    new(&young->lock)std::mutex();
+
+    young->list = nullptr;
+    young->count = 0;
+    young->unpublished = 0;
+    young->orphan = false;
+
+    std::unique_lock _(young_lock);
+
+    young->next = young_lists;
+    young_lists = young;
+
+    young_local = young;
+
+    return young;
+}
+
+void MergeYoungLists() {
+    // NB: track_lock must be held by the caller
+    std::unique_lock registry(young_lock);
+
+    auto **cursor = &young_lists;
+
+    while (*cursor != nullptr) {
+        auto *young = *cursor;
+
+        std::unique_lock lock(young->lock);
+
+        if (young->list != nullptr) {
+            auto *tail = young->list;
+
+            // Handshake: from now on these objects belong to the collector
+            for (;; tail = tail->Next()) {
+                tail->SetYoung(false);
+
+                if (tail->Next() == nullptr)
+                    break;
+            }
+
+            tail->SetNext(generations[0].list);
+            if (generations[0].list != nullptr)
+                generations[0].list->prev = &tail->next;
+
+            young->list->prev = &(generations[0].list);
+            generations[0].list = young->list;
+
+            total_tracked += young->count;
+
+            young->list = nullptr;
+            young->count = 0;
+        }
+
+        allocations.fetch_add(young->unpublished, std::memory_order_relaxed);
+        young->unpublished = 0;
+
+        if (!young->orphan) {
+            cursor = &young->next;
+            continue;
+        }
+
+        lock.unlock();
+
+        *cursor = young->next;
+
+        young->lock.~mutex();
+        stratum::Free(young);
+    }
+}
+
+void YoungInsert(GCHead *head) {
+    auto *young = GetYoungList();
+
+    if (young == nullptr) {
+        std::unique_lock _(track_lock);
+
+        GCHeadInsert(&(generations[0].list), head);
+        head->SetYoung(false);
+
+        total_tracked++;
+        allocations++;
+
+        return;
+    }
+
+    std::unique_lock _(young->lock);
+
+    GCHeadInsert(&young->list, head);
+    head->SetYoung(true);
+
+    young->count++;
+
+    if (++young->unpublished >= kGCYoungBatch) {
+        allocations.fetch_add(young->unpublished, std::memory_order_relaxed);
+        young->unpublished = 0;
+    }
+}
+
+void RunCollection() {
+    Collect(0);
+
+    for (unsigned short i = 1; i < kGCGenerations; i++)
+        if (generations[i - 1].times >= generations[i].threshold)
+            Collect(i);
+}
+
+void Collector() {
+    std::unique_lock lock(collector_lock);
+
+    while (!collector_stop) {
+        collector_cond.wait(lock, [] { return gc_requested || collector_stop; });
+
+        if (collector_stop)
+            break;
+
+        lock.unlock();
+
+        // The garbage is left to the fibers (see ThresholdCollect), the dtors never run on this thread
+        RunCollection();
+
+        // Good time to return the pages of the arenas left idle by the previous sweep (see --decay)
+        MemoryDecay();
+
+        lock.lock();
+
+        gc_requested = false;
+
+        collector_done.notify_all();
+    }
+}
+
+void WaitCollection() {
+    // Release the VCore, the other fibers can keep running while this one waits for the collector
+    argon::vm::EnterBlocking();
+
+    {
+        std::unique_lock lock(collector_lock);
+
+        collector_done.wait(lock, [] { return !gc_requested || collector_stop; });
+    }
+
+    argon::vm::LeaveBlocking();
+}
+
 void ResetStats(unsigned short generation) {
     if (generation == 0) {
         allocations = 0;
@@ -122,25 +333,24 @@ void TraceRoots(GCGeneration *generation, GCHead **unreachable) {
 }
 
 void Trashing(GCGeneration *generation, GCGeneration *next_generation, GCHead *unreachables) {
-    argon::vm::datatype::ArObject *object;
     GCHead *head;
 
     for (GCHead *cursor = unreachables; cursor != nullptr; cursor = head) {
-        object = cursor->GetObject();
         head = cursor->Next();
 
         GCHeadRemove(cursor);
 
-        // Check if objects are really unreachable
+        // Check if objects are really unreachable, they are finalized later by Sweep
         if (cursor->ref == 0) {
-            AR_GET_TYPE(object)->dtor(object); // TODO: check return value...
-
             generation->collected++;
 
             std::unique_lock lock(garbage_lock);
 
             GCHeadInsert(&garbage, cursor);
 
+            sweep_pending = true;
+            gc_safepoint = true;
+
             total_tracked--;
 
             continue;
@@ -179,13 +389,10 @@ argon::vm::datatype::ArObject *argon::vm::memory::GCNew(const datatype::TypeInfo
         AR_GET_TYPE(ret) = type;
         AR_UNSAFE_GET_MON(ret) = nullptr;
 
-        if (track) {
-            std::unique_lock lock(track_lock);
+        HeapProfTrackObject(ret, head);
 
-            GCHeadInsert(&(generations[0].list), head);
-            total_tracked++;
-            allocations++;
-        }
+        if (track)
+            YoungInsert(head);
 
         return ret;
     }
@@ -200,6 +407,8 @@ size_t argon::vm::memory::Collect(unsigned short generation) {
 
     std::unique_lock lock(track_lock);
 
+    MergeYoungLists();
+
     if ((next_gen = (generation + 1) % kGCGenerations) == 0)
         next_gen = kGCGenerations - 1;
 
@@ -243,6 +452,53 @@ bool argon::vm::memory::GCIsEnabled() {
     return enabled;
 }
 
+bool argon::vm::memory::GCStartCollector() {
+    if (collector_running)
+        return true;
+
+    collector_stop = false;
+
+    try {
+        collector = std::thread(Collector);
+    } catch (const std::system_error &) {
+        return false;
+    }
+
+    collector_running = true;
+
+    return true;
+}
+
+void argon::vm::memory::GCStopCollector() {
+    if (!collector_running)
+        return;
+
+    {
+        std::unique_lock _(collector_lock);
+        collector_stop = true;
+    }
+
+    collector_cond.notify_one();
+    collector_done.notify_all();
+
+    collector.join();
+
+    collector_running = false;
+}
+
+void argon::vm::memory::GCThreadDetach() {
+    auto *young = young_local;
+
+    if (young == nullptr)
+        return;
+
+    std::unique_lock _(young->lock);
+
+    young->orphan = true;
+
+    young_local = nullptr;
+}
+
 GCHead *argon::vm::memory::GCGetHead(datatype::ArObject *object) {
     if (object == nullptr || !AR_GET_RC(object).IsGcObject())
         return nullptr;
@@ -271,6 +527,20 @@ void argon::vm::memory::GCFree(datatype::ArObject *object) {
     }
 }
 
+void argon::vm::memory::GCSafePoint() {
+    if (!gc_safepoint.exchange(false, std::memory_order_relaxed))
+        return;
+
+    ArSize debt = allocations - deallocations;
+
+    // Allocating faster than the collector can keep up, wait for the running collection
+    if (collector_running && gc_requested && debt >= (ArSize) generations[0].threshold * kGCDebtLimit)
+        WaitCollection();
+
+    if (sweep_pending.load(std::memory_order_relaxed))
+        Sweep();
+}
+
 void argon::vm::memory::Sweep() {
     GCHead *cursor;
 
@@ -279,8 +549,17 @@ void argon::vm::memory::Sweep() {
     cursor = garbage;
     garbage = nullptr;
 
+    sweep_pending = false;
+
     lock.unlock();
 
+    // A dtor may release other objects of the same list, the memory is freed only after running all of them
+    for (auto *head = cursor; head != nullptr; head = head->Next()) {
+        auto *obj = head->GetObject();
+
+        AR_GET_TYPE(obj)->dtor(obj); // TODO: check return value...
+    }
+
     while (cursor != nullptr) {
         auto *obj = cursor->GetObject();
         auto *tmp = cursor;
@@ -298,21 +577,37 @@ void argon::vm::memory::Sweep() {
 void argon::vm::memory::ThresholdCollect() {
     bool desired = false;
 
-    if (!enabled || (allocations - deallocations) < generations[0].threshold)
+    // NB: the caller may hold object locks (e.g. ListAppend -> TrackIf), never wait or run a dtor here (see GCSafePoint)
+    ArSize debt = allocations - deallocations;
+
+    if (!enabled || debt < generations[0].threshold)
         return;
 
-    if (!gc_requested.compare_exchange_strong(desired, true, std::memory_order_relaxed))
+    if (!gc_requested.compare_exchange_strong(desired, true, std::memory_order_relaxed)) {
+        // A collection is already running, past the debt limit the next safe point waits for it
+        if (collector_running && debt >= (ArSize) generations[0].threshold * kGCDebtLimit)
+            gc_safepoint = true;
+
         return;
+    }
 
-    Collect(0);
+    if (collector_running) {
+        // The lock pairs with the wait of the collector, otherwise the notification could be lost
+        { std::unique_lock _(collector_lock); }
 
-    for (unsigned short i = 1; i < kGCGenerations; i++)
-        if (generations[i - 1].times >= generations[i].threshold)
-            Collect(i);
+        collector_cond.notify_one();
 
-    gc_requested = false;
+        return;
+    }
+
+    // No collector yet, collect on this thread (the object locks are recursive),
+    // the garbage is finalized by the next safe point
+    RunCollection();
 
-    Sweep();
+    // Good time to return the pages of the arenas left idle by the collection (see --decay)
+    MemoryDecay();
+
+    gc_requested = false;
 }
 
 void argon::vm::memory::Track(datatype::ArObject *object) {
@@ -322,12 +617,10 @@ void argon::vm::memory::Track(datatype::ArObject *object) {
 
     ThresholdCollect();
 
-    std::unique_lock lock(track_lock);
-    if (!head->IsTracked()) {
-        GCHeadInsert(&(generations[0].list), head);
-        total_tracked++;
-        allocations++;
-    }
+    if (head->IsTracked() || !ClaimHead(head))
+        return;
+
+    YoungInsert(head);
 }
 
 void argon::vm::memory::TrackIf(datatype::ArObject *track, datatype::ArObject *gc_object) {
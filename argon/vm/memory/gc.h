@@ -5,6 +5,8 @@
 #ifndef ARGON_MEMORY_GC_H_
 #define ARGON_MEMORY_GC_H_
 
+#include <atomic>
+
 #include <argon/vm/datatype/objectdef.h>
 
 #include <argon/vm/memory/memory.h>
@@ -32,6 +34,11 @@ namespace argon::vm::memory {
             return ((((uintptr_t) this->next) & GCBitOffsets::FinalizedMask) >> GCBitOffsets::FinalizedShift);
         }
 
+        /// Tracked, but still in the young list of the thread that tracked it (see GCThreadDetach).
+        [[nodiscard]] bool IsYoung() const {
+            return ((((uintptr_t) this->next) & GCBitOffsets::YoungMask) >> GCBitOffsets::YoungShift);
+        }
+
         [[nodiscard]] bool IsVisited() const {
             return ((((uintptr_t) this->next) & GCBitOffsets::VisitedMask) >> GCBitOffsets::VisitedShift);
         }
@@ -51,6 +58,13 @@ namespace argon::vm::memory {
                 this->next = (GCHead *) (((uintptr_t) this->next) & ~GCBitOffsets::FinalizedMask);
         }
 
+        void SetYoung(bool young) {
+            if (young)
+                this->next = (GCHead *) (((uintptr_t) this->next) | GCBitOffsets::YoungMask);
+            else
+                this->next = (GCHead *) (((uintptr_t) this->next) & ~GCBitOffsets::YoungMask);
+        }
+
         void SetVisited(bool visited) {
             if (visited)
                 this->next = (GCHead *) (((uintptr_t) this->next) | GCBitOffsets::VisitedMask);
@@ -70,6 +84,9 @@ namespace argon::vm::memory {
         int times;
     };
 
+    /// Set when GCSafePoint has work to do: garbage to finalize or allocation debt to repay.
+    extern std::atomic_bool gc_safepoint;
+
     datatype::ArObject *GCNew(const datatype::TypeInfo *type, bool track);
 
     datatype::ArSize Collect(unsigned short generation);
@@ -80,8 +97,52 @@ namespace argon::vm::memory {
 
     bool GCIsEnabled();
 
+    /**
+     * @brief Start the background collector thread.
+     *
+     * From now on ThresholdCollect only wakes up the collector, the fiber that
+     * crossed the threshold does not run the collection itself. The collector does not
+     * run the dtors: the unreachable objects are finalized by the next fiber that reaches
+     * a safe point (see GCSafePoint).
+     *
+     * @return True on success, false otherwise.
+     */
+    bool GCStartCollector();
+
+    /**
+     * @brief Stop the background collector thread and wait for the current collection (if any...).
+     */
+    void GCStopCollector();
+
+    /**
+     * @brief Hand the young list of the current OS thread over to the collector.
+     *
+     * Must be called by an OS thread that is about to terminate, the objects it tracked
+     * are merged into the first generation by the next collection.
+     */
+    void GCThreadDetach();
+
     GCHead *GCGetHead(datatype::ArObject *object);
 
+    /**
+     * @brief Finalize the garbage found by the collector and pace the allocating fibers.
+     *
+     * Runs the dtors of the unreachable objects (see Sweep) and, if the current fiber allocated too much
+     * while a collection was running, waits for it. Track never does either of these, because its caller
+     * may hold object locks that the collector needs to trace. This must be called only where the
+     * current fiber holds no object lock (e.g. a preemption point of the top-level Eval).
+     */
+    void GCSafePoint();
+
+    /**
+     * @brief Check if GCSafePoint has pending work.
+     *
+     * @return True if GCSafePoint should be called, false otherwise.
+     */
+    inline bool GCSafePointRequested() {
+        return gc_safepoint.load(std::memory_order_relaxed);
+    }
+
     void GCFree(datatype::ArObject *object);
 
     inline void GCFreeRaw(datatype::ArObject *object) {
@@ -0,0 +1,599 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <shared_mutex>
+
+#include <argon/vm/runtime.h>
+
+#include <argon/vm/datatype/arstring.h>
+#include <argon/vm/datatype/code.h>
+#include <argon/vm/datatype/dict.h>
+#include <argon/vm/datatype/error.h>
+#include <argon/vm/datatype/integer.h>
+#include <argon/vm/datatype/list.h>
+#include <argon/vm/datatype/nil.h>
+#include <argon/vm/datatype/tuple.h>
+
+#include <argon/vm/memory/memory.h>
+
+#include <argon/vm/memory/heapprof.h>
+
+using namespace argon::vm;
+using namespace argon::vm::datatype;
+
+constexpr unsigned short kHeapProfSiteBuckets = 1024;
+
+constexpr unsigned int kHeapProfSampleBuckets = 16384;
+
+constexpr unsigned short kHeapProfSampleStripes = 64;
+
+/// Type reported for the memory blocks that do not hold an object.
+constexpr const char *kHeapProfRawType = "<raw>";
+
+/// Blocks allocated by the same code/line with the same type and size.
+struct HeapSite {
+    /// Next site in the same bucket.
+    HeapSite *next;
+
+    /// Type of the objects (strong reference, released with the site), nullptr for raw memory blocks.
+    const TypeInfo *type;
+
+    /// Qualified name of the allocating code, nullptr if the sites are not recorded.
+    /// Only the name is retained (strings hold no references), the Code object itself can still be released.
+    String *name;
+
+    unsigned int line;
+
+    /// Bytes allocated for each block.
+    size_t size;
+
+    /// Live samples.
+    std::atomic<unsigned long long> live;
+};
+
+struct HeapSample {
+    /// Next sample in the same bucket.
+    HeapSample *next;
+
+    const void *block;
+
+    HeapSite *site;
+};
+
+/// Entry of a snapshot diff (see HeapProfDiff).
+struct HeapDelta {
+    ArObject *key;
+
+    IntegerUnderlying count;
+
+    IntegerUnderlying bytes;
+};
+
+std::atomic_bool argon::vm::memory::heapprof_enabled = false;
+
+std::atomic_size_t argon::vm::memory::heapprof_live = 0;
+
+thread_local long long argon::vm::memory::heapprof_countdown = 0;
+
+thread_local const void *argon::vm::memory::heapprof_last_block = nullptr;
+
+static std::atomic<HeapSite *> sites[kHeapProfSiteBuckets];
+static std::mutex sites_lock;
+
+/// Shared by everyone that uses the sites, exclusive while they are released (see HeapProfStart/HeapProfStop).
+static std::shared_mutex sites_rwlock;
+
+static std::atomic<HeapSample *> samples[kHeapProfSampleBuckets];
+static std::mutex samples_lock[kHeapProfSampleStripes];
+
+static std::atomic_size_t sample_rate = memory::kHeapProfDefaultRate;
+static std::atomic_bool record_sites = true;
+
+std::atomic_uint argon::vm::memory::heapprof_session = 0;
+
+thread_local unsigned int argon::vm::memory::heapprof_thread_session = 0;
+
+thread_local unsigned long long rng_state = 0;
+
+/// Set while the current thread takes a snapshot, its own allocations are not sampled.
+thread_local bool snapshot_running = false;
+
+long long NextCountdown(size_t rate) {
+    if (rate <= 1)
+        return 0;
+
+    if (rng_state == 0) {
+        rng_state = (unsigned long long) &rng_state
+                    ^ (unsigned long long) std::chrono::steady_clock::now().time_since_epoch().count();
+
+        if (rng_state == 0)
+            rng_state = 0x9E3779B97F4A7C15ull;
+    }
+
+    // xorshift64
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+
+    // Exponentially distributed distance (mean = rate), every byte has the same probability of being sampled
+    auto uniform = ((double) (rng_state >> 11) + 1.0) / 9007199254740993.0;
+
+    return (long long) (-std::log(uniform) * (double) rate) + 1;
+}
+
+HeapSite *LookupSite(const TypeInfo *type, const String *name, unsigned int line, size_t size) {
+    auto hash = (((uintptr_t) type) >> 4) ^ (((uintptr_t) name) >> 4) ^ (line * 31) ^ size;
+    auto &bucket = sites[hash % kHeapProfSiteBuckets];
+
+    for (auto *cursor = bucket.load(std::memory_order_acquire); cursor != nullptr; cursor = cursor->next) {
+        if (cursor->type == type && cursor->name == name && cursor->line == line && cursor->size == size)
+            return cursor;
+    }
+
+    std::unique_lock _(sites_lock);
+
+    for (auto *cursor = bucket.load(std::memory_order_relaxed); cursor != nullptr; cursor = cursor->next) {
+        if (cursor->type == type && cursor->name == name && cursor->line == line && cursor->size == size)
+            return cursor;
+    }
+
+    // Allocated outside the Argon heap, so the profiler never samples its own data
+    auto *site = (HeapSite *) stratum::Calloc(1, sizeof(HeapSite));
+    if (site == nullptr)
+        return nullptr;
+
+    site->type = IncRef((TypeInfo *) type);
+    site->name = IncRef((String *) name);
+    site->line = line;
+    site->size = size;
+    site->next = bucket.load(std::memory_order_relaxed);
+
+    bucket.store(site, std::memory_order_release);
+
+    return site;
+}
+
+ArObject *MakeSiteKey(const HeapSite *site) {
+    ArObject *location = nullptr;
+    Tuple *ret;
+
+    if (site->name != nullptr) {
+        location = (ArObject *) StringFormat("%s:%u", ARGON_RAW_STRING(site->name), site->line);
+        if (location == nullptr)
+            return nullptr;
+    }
+
+    ret = TupleNew("so", site->type != nullptr ? site->type->name : kHeapProfRawType, location);
+
+    Release(location);
+
+    return (ArObject *) ret;
+}
+
+void ClearSamples() {
+    for (unsigned int i = 0; i < kHeapProfSampleBuckets; i++) {
+        std::unique_lock _(samples_lock[i % kHeapProfSampleStripes]);
+
+        auto *cursor = samples[i].exchange(nullptr, std::memory_order_acq_rel);
+
+        while (cursor != nullptr) {
+            auto *next = cursor->next;
+
+            stratum::Free(cursor);
+
+            memory::heapprof_live.fetch_sub(1, std::memory_order_relaxed);
+
+            cursor = next;
+        }
+    }
+}
+
+HeapSite *DetachSites() {
+    HeapSite *list = nullptr;
+
+    // Called with sites_rwlock held exclusively, no sample refers to the sites anymore (see ClearSamples)
+    for (auto &bucket: sites) {
+        auto *cursor = bucket.exchange(nullptr, std::memory_order_acq_rel);
+
+        while (cursor != nullptr) {
+            auto *next = cursor->next;
+
+            cursor->next = list;
+            list = cursor;
+
+            cursor = next;
+        }
+    }
+
+    return list;
+}
+
+void ReleaseSites(HeapSite *list) {
+    while (list != nullptr) {
+        auto *next = list->next;
+
+        Release((TypeInfo *) list->type);
+        Release(list->name);
+
+        stratum::Free(list);
+
+        list = next;
+    }
+}
+
+bool UnpackEntry(const ArObject *value, IntegerUnderlying *count, IntegerUnderlying *bytes) {
+    if (!AR_TYPEOF(value, type_tuple_)) {
+        ErrorFormat(kTypeError[0], "heap snapshot: expected '%s' as value, got '%s'",
+                    type_tuple_->name, AR_TYPE_NAME(value));
+
+        return false;
+    }
+
+    return TupleUnpack((const Tuple *) value, "ll", count, bytes);
+}
+
+double SampleProbability(size_t size, size_t rate) {
+    if (rate <= 1)
+        return 1;
+
+    return 1 - std::exp(-((double) size / (double) rate));
+}
+
+bool SnapshotGet(Dict *snapshot, ArObject *key, IntegerUnderlying *count, IntegerUnderlying *bytes) {
+    *count = 0;
+    *bytes = 0;
+
+    if (snapshot == nullptr)
+        return true;
+
+    auto *value = DictLookup(snapshot, key);
+    if (value == nullptr)
+        return !IsPanicking();
+
+    auto ok = UnpackEntry(value, count, bytes);
+
+    Release(value);
+
+    return ok;
+}
+
+bool SnapshotAdd(Dict *snapshot, ArObject *key, IntegerUnderlying count, IntegerUnderlying bytes) {
+    IntegerUnderlying old_count;
+    IntegerUnderlying old_bytes;
+
+    if (!SnapshotGet(snapshot, key, &old_count, &old_bytes))
+        return false;
+
+    auto *value = TupleNew("ll", old_count + count, old_bytes + bytes);
+    if (value == nullptr)
+        return false;
+
+    auto ok = DictInsert(snapshot, key, (ArObject *) value);
+
+    Release(value);
+
+    return ok;
+}
+
+bool CollectDeltas(Dict *from, Dict *other, HeapDelta **deltas, ArSize *length, ArSize *capacity, bool negate) {
+    IntegerUnderlying count;
+    IntegerUnderlying bytes;
+    IntegerUnderlying other_count;
+    IntegerUnderlying other_bytes;
+
+    std::shared_lock _(from->rwlock);
+
+    for (auto *cursor = from->hmap.iter_begin; cursor != nullptr; cursor = cursor->iter_next) {
+        if (negate) {
+            // Only the keys that disappeared, the others were already counted
+            auto *found = other != nullptr ? DictLookup(other, cursor->key) : nullptr;
+            if (found != nullptr) {
+                Release(found);
+                continue;
+            }
+        } else if (!SnapshotGet(other, cursor->key, &other_count, &other_bytes))
+            return false;
+
+        if (!UnpackEntry(cursor->value, &count, &bytes))
+            return false;
+
+        if (negate) {
+            count = -count;
+            bytes = -bytes;
+        } else {
+            count -= other_count;
+            bytes -= other_bytes;
+        }
+
+        if (count == 0 && bytes == 0)
+            continue;
+
+        if (*length == *capacity) {
+            auto new_capacity = *capacity == 0 ? 64 : *capacity * 2;
+
+            auto *tmp = (HeapDelta *) memory::Realloc(*deltas, new_capacity * sizeof(HeapDelta));
+            if (tmp == nullptr)
+                return false;
+
+            *deltas = tmp;
+            *capacity = new_capacity;
+        }
+
+        (*deltas)[(*length)++] = {IncRef(cursor->key), count, bytes};
+    }
+
+    return true;
+}
+
+bool argon::vm::memory::HeapProfIsAvailable() {
+#ifdef ARGON_FF_HEAPPROF
+    return true;
+#else
+    return false;
+#endif
+}
+
+List *argon::vm::memory::HeapProfDiff(Dict *old_snap, Dict *new_snap) {
+    HeapDelta *deltas = nullptr;
+    ArSize capacity = 0;
+    ArSize length = 0;
+    List *ret = nullptr;
+
+    if (!CollectDeltas(new_snap, old_snap, &deltas, &length, &capacity, false)
+        || !CollectDeltas(old_snap, new_snap, &deltas, &length, &capacity, true))
+        goto CLEANUP;
+
+    std::sort(deltas, deltas + length, [](const HeapDelta &a, const HeapDelta &b) {
+        return a.bytes > b.bytes;
+    });
+
+    if ((ret = ListNew(length)) == nullptr)
+        goto CLEANUP;
+
+    for (ArSize i = 0; i < length; i++) {
+        auto *key = (Tuple *) deltas[i].key;
+
+        auto *entry = TupleNew("OOll", key->objects[0], key->objects[1], deltas[i].count, deltas[i].bytes);
+        if (entry == nullptr) {
+            Release(ret);
+
+            ret = nullptr;
+            goto CLEANUP;
+        }
+
+        ListAppend(ret, (datatype::ArObject *) entry);
+
+        Release(entry);
+    }
+
+    CLEANUP:
+    for (ArSize i = 0; i < length; i++)
+        Release(deltas[i].key);
+
+    memory::Free(deltas);
+
+    return ret;
+}
+
+Dict *argon::vm::memory::HeapProfSnapshot() {
+    auto rate = sample_rate.load(std::memory_order_relaxed);
+
+    std::shared_lock _(sites_rwlock);
+
+    snapshot_running = true;
+
+    auto *snapshot = DictNew();
+    if (snapshot == nullptr) {
+        snapshot_running = false;
+        return nullptr;
+    }
+
+    for (auto &bucket: sites) {
+        for (auto *cursor = bucket.load(std::memory_order_acquire); cursor != nullptr; cursor = cursor->next) {
+            auto live = cursor->live.load(std::memory_order_relaxed);
+
+            if (live == 0)
+                continue;
+
+            // Each sample stands for 1/p objects of the same size
+            auto count = (IntegerUnderlying) std::llround((double) live / SampleProbability(cursor->size, rate));
+
+            auto *key = MakeSiteKey(cursor);
+            if (key == nullptr || !SnapshotAdd(snapshot, key, count, count * (IntegerUnderlying) cursor->size)) {
+                snapshot_running = false;
+
+                Release(key);
+                Release(snapshot);
+
+                return nullptr;
+            }
+
+            Release(key);
+        }
+    }
+
+    snapshot_running = false;
+
+    return snapshot;
+}
+
+bool argon::vm::memory::HeapProfStart(size_t rate, bool sites_enabled) {
+    if (!HeapProfIsAvailable())
+        return false;
+
+    HeapSite *old;
+
+    heapprof_enabled = false;
+
+    {
+        std::unique_lock _(sites_rwlock);
+
+        // Drop the samples and the sites of the previous session
+        ClearSamples();
+
+        old = DetachSites();
+
+        sample_rate = rate;
+        record_sites = sites_enabled;
+
+        heapprof_session.fetch_add(1, std::memory_order_release);
+
+        heapprof_enabled = true;
+    }
+
+    // Outside the lock, a release may run a destructor that frees other sampled blocks
+    ReleaseSites(old);
+
+    return true;
+}
+
+bool argon::vm::memory::HeapProfStop() {
+    HeapSite *old;
+
+    auto enabled = heapprof_enabled.exchange(false);
+
+    {
+        std::unique_lock _(sites_rwlock);
+
+        // Once heapprof_live drops to zero the free path no longer pays for the lookup (see HeapProfTrackFree)
+        ClearSamples();
+
+        old = DetachSites();
+    }
+
+    ReleaseSites(old);
+
+    return enabled;
+}
+
+void argon::vm::memory::HeapProfSample(const void *block, size_t size) {
+    const String *name = nullptr;
+    unsigned int line = 0;
+
+    auto current = heapprof_session.load(std::memory_order_acquire);
+
+    heapprof_countdown = NextCountdown(sample_rate.load(std::memory_order_relaxed));
+
+    if (heapprof_thread_session != current) {
+        // The countdown belongs to a previous session (or to a different rate)
+        heapprof_thread_session = current;
+
+        if ((heapprof_countdown -= (long long) size) > 0)
+            return;
+    }
+
+    if (snapshot_running)
+        return;
+
+    if (record_sites.load(std::memory_order_relaxed)) {
+        const auto *fiber = GetFiber();
+
+        if (fiber != nullptr && fiber->frame != nullptr) {
+            const auto *frame = fiber->frame;
+
+            const auto *code = frame->code;
+
+            name = code->qname != nullptr ? code->qname : code->name;
+            line = code->GetLineMapping((ArSize) (frame->instr_ptr - code->instr));
+        }
+    }
+
+    std::shared_lock lock(sites_rwlock);
+
+    // Raw memory until the caller attaches the type of the object it contains (see HeapProfSetType)
+    auto *site = LookupSite(nullptr, name, line, size);
+    if (site == nullptr)
+        return;
+
+    auto index = (((uintptr_t) block) >> 4) % kHeapProfSampleBuckets;
+
+    std::unique_lock _(samples_lock[index % kHeapProfSampleStripes]);
+
+    heapprof_last_block = block;
+
+    // The memory may have been released without passing through HeapProfTrackFree, reuse its stale sample
+    for (auto *cursor = samples[index].load(std::memory_order_relaxed); cursor != nullptr; cursor = cursor->next) {
+        if (cursor->block == block) {
+            cursor->site->live.fetch_sub(1, std::memory_order_relaxed);
+            cursor->site = site;
+
+            site->live.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    auto *sample = (HeapSample *) stratum::Alloc(sizeof(HeapSample));
+    if (sample == nullptr)
+        return;
+
+    sample->block = block;
+    sample->site = site;
+    sample->next = samples[index].load(std::memory_order_relaxed);
+
+    site->live.fetch_add(1, std::memory_order_relaxed);
+    heapprof_live.fetch_add(1, std::memory_order_relaxed);
+
+    samples[index].store(sample, std::memory_order_release);
+}
+
+void argon::vm::memory::HeapProfSetType(const datatype::ArObject *object, const void *block) {
+    heapprof_last_block = nullptr;
+
+    if (snapshot_running)
+        return;
+
+    std::shared_lock lock(sites_rwlock);
+
+    auto index = (((uintptr_t) block) >> 4) % kHeapProfSampleBuckets;
+
+    std::unique_lock _(samples_lock[index % kHeapProfSampleStripes]);
+
+    for (auto *cursor = samples[index].load(std::memory_order_relaxed); cursor != nullptr; cursor = cursor->next) {
+        if (cursor->block == block) {
+            auto *old = cursor->site;
+
+            auto *site = LookupSite(AR_GET_TYPE(object), old->name, old->line, old->size);
+            if (site == nullptr)
+                return;
+
+            old->live.fetch_sub(1, std::memory_order_relaxed);
+            site->live.fetch_add(1, std::memory_order_relaxed);
+
+            cursor->site = site;
+            return;
+        }
+    }
+}
+
+void argon::vm::memory::HeapProfUntrack(const void *block) {
+    auto index = (((uintptr_t) block) >> 4) % kHeapProfSampleBuckets;
+
+    // Most objects are not sampled, avoid taking the lock if the bucket is empty
+    if (samples[index].load(std::memory_order_acquire) == nullptr)
+        return;
+
+    std::unique_lock _(samples_lock[index % kHeapProfSampleStripes]);
+
+    HeapSample *prev = nullptr;
+    for (auto *cursor = samples[index].load(std::memory_order_relaxed); cursor != nullptr; cursor = cursor->next) {
+        if (cursor->block == block) {
+            if (prev == nullptr)
+                samples[index].store(cursor->next, std::memory_order_release);
+            else
+                prev->next = cursor->next;
+
+            cursor->site->live.fetch_sub(1, std::memory_order_relaxed);
+            heapprof_live.fetch_sub(1, std::memory_order_relaxed);
+
+            stratum::Free(cursor);
+            return;
+        }
+
+        prev = cursor;
+    }
+}
@@ -5,6 +5,7 @@
 #include <argon/vm/runtime.h>
 #include <argon/vm/datatype/error.h>
 
+#include <argon/vm/memory/heapprof.h>
 #include <argon/vm/memory/memory.h>
 
 using namespace argon::vm::memory;
@@ -12,8 +13,12 @@ using namespace argon::vm::memory;
 void *argon::vm::memory::Alloc(size_t size) {
     auto *mem = stratum::Alloc(size);
 
-    if (mem == nullptr)
+    if (mem == nullptr) {
         Panic((datatype::ArObject *) datatype::error_oom);
+        return nullptr;
+    }
+
+    HeapProfTrackAlloc(mem, size);
 
     return mem;
 }
@@ -21,21 +26,36 @@ void *argon::vm::memory::Alloc(size_t size) {
 void *argon::vm::memory::Calloc(size_t size) {
     auto *mem = stratum::Calloc(size);
 
-    if (mem == nullptr)
+    if (mem == nullptr) {
         Panic((datatype::ArObject *) datatype::error_oom);
+        return nullptr;
+    }
+
+    HeapProfTrackAlloc(mem, size);
 
     return mem;
 }
 
 void argon::vm::memory::Free(void *ptr) {
+    if (ptr != nullptr)
+        HeapProfTrackFree(ptr);
+
     stratum::Free(ptr);
 }
 
 void *argon::vm::memory::Realloc(void *ptr, size_t size) {
+    // Once reallocated the old block can be reused by another thread, forget it first
+    if (ptr != nullptr)
+        HeapProfTrackFree(ptr);
+
     auto *mem = stratum::Realloc(ptr, size);
 
-    if (mem == nullptr)
+    if (mem == nullptr) {
         Panic((datatype::ArObject *) datatype::error_oom);
+        return nullptr;
+    }
+
+    HeapProfTrackAlloc(mem, size);
 
     return mem;
 }
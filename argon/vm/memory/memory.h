@@ -18,6 +18,9 @@ namespace argon::vm::memory {
     const auto MemoryZero = stratum::util::MemoryZero;
     const auto MemoryInit = stratum::Initialize;
     const auto MemoryFinalize = stratum::Finalize;
+    const auto MemoryDecay = stratum::Decay;
+    const auto MemorySetDecay = stratum::SetDecay;
+    const auto MemorySetArenaMode = stratum::SetArenaMode;
 
     void *Alloc(size_t size);
 
@@ -26,6 +26,7 @@
 #include <argon/vm/datatype/option.h>
 #include <argon/vm/datatype/result.h>
 #include <argon/vm/datatype/set.h>
+#include <argon/vm/datatype/taskgroup.h>
 #include <argon/vm/datatype/tuple.h>
 
 using namespace argon::vm::datatype;
@@ -88,24 +89,26 @@ ARGON_FUNCTION(builtins_eval, eval,
                "- KWParameters:\n"
                "  - optim: Set optimization level (0-3).\n"
                "- Returns: A result object that contains the result of the evaluation.\n",
-               "s: name, m: module, sx: src", false, true) {
+               "s: name, m: module, sx: src", false, kFunctionKWArgsView) {
     ArBuffer buffer{};
     auto *f = argon::vm::GetFiber();
-    int optim_lvl = 0;
+    IntegerUnderlying optim_lvl = 0;
 
     if (f != nullptr)
         optim_lvl = f->context->global_config->optim_lvl;
 
-    optim_lvl = (int) DictLookupInt((Dict *) kwargs, "optim", optim_lvl);
+    if (!KParamLookupInt((Dict *) kwargs, "optim", &optim_lvl, optim_lvl))
+        return nullptr;
+
     if (optim_lvl < 0 || optim_lvl > 3) {
-        ErrorFormat(kValueError[0], "invalid optimization level. Expected a value between 0 and 3, got: %d", optim_lvl);
+        ErrorFormat(kValueError[0], "invalid optimization level. Expected a value between 0 and 3, got: %d", (int) optim_lvl);
         return nullptr;
     }
 
     if (!BufferGet(args[2], &buffer, BufferFlags::READ))
         return nullptr;
 
-    argon::lang::CompilerWrapper c_wrapper(optim_lvl);
+    argon::lang::CompilerWrapper c_wrapper((int) optim_lvl);
 
     auto *code = c_wrapper.Compile((const char *) ARGON_RAW_STRING((String *) args[0]),
                                    (const char *) buffer.buffer,
@@ -139,7 +142,7 @@ ARGON_FUNCTION(builtins_getattr, getattr,
                "  - default: A default value to return if the attribute does not exist.\n"
                "- Returns: If the attribute exists within the object, its value is returned, "
                "otherwise the default value if defined is returned.\n",
-               ": obj, s: name", false, true) {
+               ": obj, s: name", false, kFunctionKWArgsView) {
     bool _static = false;
 
     if (AR_GET_TYPE(*args) == type_type_)
@@ -149,7 +152,7 @@ ARGON_FUNCTION(builtins_getattr, getattr,
     if (res == nullptr) {
         ArObject *def = nullptr;
 
-        if (kwargs != nullptr && !DictLookup((Dict *) kwargs, "default", &def))
+        if (!KParamLookup((Dict *) kwargs, "default", nullptr, &def, nullptr, false))
             return nullptr;
 
         if (def != nullptr)
@@ -490,6 +493,7 @@ const ModuleEntry builtins_entries[] = {
         MODULE_EXPORT_TYPE(type_result_),
         MODULE_EXPORT_TYPE(type_set_),
         MODULE_EXPORT_TYPE(type_string_),
+        MODULE_EXPORT_TYPE(type_taskgroup_),
         MODULE_EXPORT_TYPE(type_type_),
         MODULE_EXPORT_TYPE(type_tuple_),
         MODULE_EXPORT_TYPE(type_uint_),
@@ -3,11 +3,15 @@
 // Licensed under the Apache License v2.0
 
 #include <argon/vm/memory/gc.h>
+#include <argon/vm/memory/heapprof.h>
 
 #include <argon/vm/datatype/boolean.h>
+#include <argon/vm/datatype/dict.h>
 #include <argon/vm/datatype/error.h>
 #include <argon/vm/datatype/function.h>
 #include <argon/vm/datatype/integer.h>
+#include <argon/vm/datatype/list.h>
+#include <argon/vm/datatype/pcheck.h>
 
 #include <argon/vm/mod/modules.h>
 
@@ -37,7 +41,12 @@ ARGON_FUNCTION(gc_collect, collect,
         return nullptr;
     }
 
-    return (ArObject *) IntNew((IntegerUnderlying) argon::vm::memory::Collect((short) gen));
+    auto collected = argon::vm::memory::Collect((short) gen);
+
+    // Finalize the unreachable objects now, on this fiber
+    argon::vm::memory::Sweep();
+
+    return (ArObject *) IntNew((IntegerUnderlying) collected);
 }
 
 ARGON_FUNCTION(gc_collectall, collectall,
@@ -45,7 +54,11 @@ ARGON_FUNCTION(gc_collectall, collectall,
                "\n"
                "- Returns: Number of collected objects is returned.\n",
                nullptr, false, false) {
-    return (ArObject *) IntNew((IntegerUnderlying) argon::vm::memory::Collect());
+    auto collected = argon::vm::memory::Collect();
+
+    argon::vm::memory::Sweep();
+
+    return (ArObject *) IntNew((IntegerUnderlying) collected);
 }
 
 ARGON_FUNCTION(gc_disable, disable,
@@ -73,6 +86,74 @@ ARGON_FUNCTION(gc_havesidetable, havesidetable,
     return BoolToArBool(AR_GET_RC(*args).HaveSideTable());
 }
 
+ARGON_FUNCTION(gc_heapprof_diff, heapprof_diff,
+               "Compare two heap snapshots.\n"
+               "\n"
+               "- Parameters:\n"
+               "  - old: Older snapshot (see heapprof_snapshot).\n"
+               "  - new: Newer snapshot.\n"
+               "- Returns: List of tuples (type, site, count delta, bytes delta) sorted by bytes delta, "
+               "largest growth first.\n",
+               "D: old, D: new", false, false) {
+    return (ArObject *) argon::vm::memory::HeapProfDiff((Dict *) args[0], (Dict *) args[1]);
+}
+
+ARGON_FUNCTION(gc_heapprof_snapshot, heapprof_snapshot,
+               "Take a snapshot of the live objects recorded by the heap profiler.\n"
+               "\n"
+               "Counts and bytes are estimated from the samples, they are exact if the profiler "
+               "was started with rate=1.\n"
+               "\n"
+               "Memory blocks that do not hold an object (e.g. the items of a list) have type \"<raw>\".\n"
+               "\n"
+               "- Returns: Dict that maps (type, site) to (count, bytes), site is \"qname:line\" "
+               "or nil if the allocation sites are not recorded.\n",
+               nullptr, false, false) {
+    return (ArObject *) argon::vm::memory::HeapProfSnapshot();
+}
+
+ARGON_FUNCTION(gc_heapprof_start, heapprof_start,
+               "Start the sampling heap profiler, data collected by the previous session are discarded.\n"
+               "\n"
+               "- KWParameters:\n"
+               "  - rate: Average number of allocated bytes between two samples (default: 131072, 1: every allocation).\n"
+               "  - sites: Record the code and line that allocated each sampled object (default: true).\n"
+               "- Returns: Heap profiler status before this call.\n",
+               nullptr, false, kFunctionKWArgsView) {
+    IntegerUnderlying rate;
+    bool sites;
+
+    if (!argon::vm::memory::HeapProfIsAvailable()) {
+        ErrorFormat(kRuntimeError[0], "heap profiler support was not compiled in (see ARGON_FF_HEAPPROF)");
+        return nullptr;
+    }
+
+    if (!KParamLookupInt((Dict *) kwargs, "rate", &rate, argon::vm::memory::kHeapProfDefaultRate))
+        return nullptr;
+
+    if (!KParamLookupBool((Dict *) kwargs, "sites", &sites, true))
+        return nullptr;
+
+    if (rate <= 0) {
+        ErrorFormat(kValueError[0], "rate must be greater than zero");
+        return nullptr;
+    }
+
+    auto enabled = argon::vm::memory::HeapProfIsEnabled();
+
+    argon::vm::memory::HeapProfStart((size_t) rate, sites);
+
+    return BoolToArBool(enabled);
+}
+
+ARGON_FUNCTION(gc_heapprof_stop, heapprof_stop,
+               "Stop sampling new allocations, the samples collected so far are discarded.\n"
+               "\n"
+               "- Returns: Heap profiler status before this call.\n",
+               nullptr, false, false) {
+    return BoolToArBool(argon::vm::memory::HeapProfStop());
+}
+
 ARGON_FUNCTION(gc_isenabled, isenabled,
                "Check if automatic collection is enabled.\n"
                "\n"
@@ -128,6 +209,10 @@ const ModuleEntry gc_entries[] = {
         MODULE_EXPORT_FUNCTION(gc_disable),
         MODULE_EXPORT_FUNCTION(gc_enable),
         MODULE_EXPORT_FUNCTION(gc_havesidetable),
+        MODULE_EXPORT_FUNCTION(gc_heapprof_diff),
+        MODULE_EXPORT_FUNCTION(gc_heapprof_snapshot),
+        MODULE_EXPORT_FUNCTION(gc_heapprof_start),
+        MODULE_EXPORT_FUNCTION(gc_heapprof_stop),
         MODULE_EXPORT_FUNCTION(gc_isenabled),
         MODULE_EXPORT_FUNCTION(gc_isimmortal),
         MODULE_EXPORT_FUNCTION(gc_istracked),
@@ -96,7 +96,7 @@ ARGON_FUNCTION(io_mkpipe, mkpipe,
                "- KWParameters:\n"
                "  - flags: flags to obtain different behavior.\n"
                "- Returns: Tuple containing two File objects, one for reading and one for writing.\n",
-               nullptr, false, true) {
+               nullptr, false, kFunctionKWArgsView) {
     IntegerUnderlying flags;
 
     if (!KParamLookupInt((Dict *) kwargs, "flags", &flags, 0))
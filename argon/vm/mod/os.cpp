@@ -49,6 +49,8 @@
 
 #include <argon/vm/mod/modules.h>
 
+#include <argon/vm/runtime.h>
+
 using namespace argon::vm;
 using namespace argon::vm::datatype;
 
@@ -151,7 +153,7 @@ ARGON_FUNCTION(os_dup, dup,
                "\n"
                "- Parameter oldfd: File descriptor referring to open file.\n"
                "- Returns: Returns a new file descriptor.\n",
-               "i: oldfd", false, true) {
+               "i: oldfd", false, kFunctionKWArgsView) {
     IntegerUnderlying newfd = 0;
     int oldfd = (int) ((Integer *) args[0])->sint;
     int result;
@@ -159,10 +161,6 @@ ARGON_FUNCTION(os_dup, dup,
     if (!KParamLookupInt((Dict *) kwargs, "newfd", &newfd, -1))
         return nullptr;
 
-    auto robj = IntNew(0);
-    if (robj == nullptr)
-        return nullptr;
-
     if (newfd < 0) {
 #ifdef _ARGON_PLATFORM_WINDOWS
         result = _dup(oldfd);
@@ -178,16 +176,12 @@ ARGON_FUNCTION(os_dup, dup,
     }
 
     if (result < 0) {
-        Release(robj);
-
         ErrorFromErrno(errno);
 
         return nullptr;
     }
 
-    robj->sint = newfd < 0 ? result : newfd;
-
-    return (ArObject *) robj;
+    return (ArObject *) IntNew(newfd < 0 ? result : newfd);
 }
 
 ARGON_FUNCTION(os_exit, exit,
@@ -353,7 +347,7 @@ ARGON_FUNCTION(os_createprocess, createprocess,
                "  - stdout: Standard output handle for the process.\n"
                "  - stderr: Standard error handle for the process.\n"
                "  - lpTitle:For console processes, this is the title displayed in the title bar if a new console window is created.\n",
-               "sn: file, sn: argv", false, true) {
+               "sn: file, sn: argv", false, kFunctionKWArgsView) {
     PROCESS_INFORMATION pinfo{};
     STARTUPINFO sinfo{};
     argon::vm::support::nt::OSHandle *ohandle = nullptr;
@@ -395,7 +389,7 @@ ARGON_FUNCTION(os_createprocess, createprocess,
         goto ERROR;
 
     // Extract environments variables
-    if (kwargs != nullptr && !DictLookup((Dict *) kwargs, (const char *) "envs", (ArObject **) &envs))
+    if (!KParamLookup((Dict *) kwargs, "envs", nullptr, (ArObject **) &envs, nullptr, false))
         goto ERROR;
 
     if (envs != nullptr && !AR_TYPEOF(envs, type_dict_) && envs != (Dict *) Nil) {
@@ -643,7 +637,7 @@ ARGON_FUNCTION(os_execve, execve,
                "- KWParameters:\n"
                "  - name: Boolean indicating whether to insert the program name as the first argument of args.\n"
                "  - envs: Dict of key/value string pairs passed to the new program as environment variables.\n",
-               "s: file, ltn: args", false, true) {
+               "s: file, ltn: args", false, kFunctionKWArgsView) {
     char **exec_args;
     char **exec_env;
 
@@ -654,7 +648,7 @@ ARGON_FUNCTION(os_execve, execve,
     if (!KParamLookupBool((Dict *) kwargs, "name", &p_name, true))
         return nullptr;
 
-    if (kwargs != nullptr && !DictLookup((Dict *) kwargs, (const char *) "envs", (ArObject **) &envs))
+    if (!KParamLookup((Dict *) kwargs, "envs", nullptr, (ArObject **) &envs, nullptr, false))
         return nullptr;
 
     if (envs != nullptr && !AR_TYPEOF(envs, type_dict_) && envs != (Dict *) Nil) {
@@ -710,23 +704,15 @@ ARGON_FUNCTION(os_fork, fork,
                "- Returns: On success, the PID of the child process is returned in the parent, "
                "and 0 is returned in the child.",
                nullptr, false, false) {
-    auto *rvalue = IntNew(0);
-    if (rvalue == nullptr)
-        return nullptr;
-
     auto status = fork();
 
     if (status < 0) {
-        Release(rvalue);
-
         ErrorFromErrno(errno);
 
         return nullptr;
     }
 
-    rvalue->sint = status;
-
-    return (ArObject *) rvalue;
+    return (ArObject *) IntNew(status);
 }
 
 #endif
@@ -824,7 +810,14 @@ ARGON_FUNCTION(os_getexitcode, getexitcode,
         return nullptr;
     }
 
-    ((Integer *) rt->objects[0])->uint = status;
+    // Small integers are shared, replace the placeholder instead of modifying it
+    auto *exit_code = UIntNew(status);
+    if (exit_code == nullptr) {
+        Release(rt);
+        return nullptr;
+    }
+
+    Replace(rt->objects, (ArObject *) exit_code);
 
     Replace(rt->objects + 1, (ArObject *) True);
 
@@ -911,8 +904,13 @@ ARGON_FUNCTION(os_listdir, listdir,
         *next = '\0';
     }
 
+    // Directory listing may block for a long time (e.g. network filesystems)
+    argon::vm::EnterBlocking();
+
     HANDLE hFind = FindFirstFile((LPCSTR) buffer, &entry);
     if (hFind == INVALID_HANDLE_VALUE) {
+        argon::vm::LeaveBlocking();
+
         if(ARGON_RAW_STRING(path) != buffer)
             memory::Free(buffer);
 
@@ -942,11 +940,18 @@ ARGON_FUNCTION(os_listdir, listdir,
 
     FindClose(hFind);
 
+    argon::vm::LeaveBlocking();
+
     if(ARGON_RAW_STRING(path) != buffer)
         memory::Free(buffer);
 #else
+    // Directory listing may block for a long time (e.g. network filesystems)
+    argon::vm::EnterBlocking();
+
     auto *dir = opendir((const char *) ARGON_RAW_STRING(path));
     if (dir == nullptr) {
+        argon::vm::LeaveBlocking();
+
         Release(ldir);
 
         ErrorFromErrno(errno);
@@ -975,6 +980,8 @@ ARGON_FUNCTION(os_listdir, listdir,
     }
 
     closedir(dir);
+
+    argon::vm::LeaveBlocking();
 #endif
 
     return (ArObject *) ldir;
@@ -1134,26 +1141,22 @@ ARGON_FUNCTION(os_waitpid, waitpid,
                "  - options: waitpid options.\n"
                "- Returns: (pid, status).\n",
                "i: pid, i: options", false, false) {
-    Tuple *rt;
     int status;
     int pid;
 
-    rt = TupleNew("ii", 0, 0);
-    if (rt == nullptr)
-        return nullptr;
+    argon::vm::EnterBlocking();
 
-    if ((pid = waitpid((int) ((Integer *) args[0])->sint, &status, (int) ((Integer *) args[1])->sint)) < 0) {
-        Release(rt);
+    pid = waitpid((int) ((Integer *) args[0])->sint, &status, (int) ((Integer *) args[1])->sint);
 
+    argon::vm::LeaveBlocking();
+
+    if (pid < 0) {
         ErrorFromErrno(errno);
 
         return nullptr;
     }
 
-    ((Integer *) rt->objects[0])->sint = pid;
-    ((Integer *) rt->objects[1])->sint = status;
-
-    return (ArObject *) rt;
+    return (ArObject *) TupleNew("ii", (ArSSize) pid, (ArSSize) status);
 }
 
 ARGON_FUNCTION(os_wpstatus, wpstatus,
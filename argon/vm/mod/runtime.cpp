@@ -3,13 +3,20 @@
 // Licensed under the Apache License v2.0
 
 #include <argon/vm/config.h>
+#include <argon/vm/profiler.h>
 #include <argon/vm/runtime.h>
 #include <argon/vm/version.h>
 
 #include <argon/vm/datatype/boolean.h>
+#include <argon/vm/datatype/error.h>
+#include <argon/vm/datatype/function.h>
 #include <argon/vm/datatype/integer.h>
+#include <argon/vm/datatype/nil.h>
+#include <argon/vm/datatype/pcheck.h>
 #include <argon/vm/datatype/tuple.h>
 
+#include <argon/vm/mod/modules.h>
+
 using namespace argon::vm::datatype;
 
 // Prototypes
@@ -18,6 +25,158 @@ Tuple *ParseCMDArgs(int argc, char **argv);
 
 // EOL
 
+bool CheckPriority(IntegerUnderlying priority) {
+    if (priority < 0 || priority >= argon::vm::kFiberPriorityCount) {
+        ErrorFormat(kValueError[0], "invalid priority class. Expected a value between 0 and %d, got: %lld",
+                    argon::vm::kFiberPriorityCount - 1, priority);
+        return false;
+    }
+
+    return true;
+}
+
+ARGON_FUNCTION(runtime_get_priority, get_priority,
+               "Get the priority class of the current fiber.\n"
+               "\n"
+               "- Returns: One of PRIORITY_INTERACTIVE, PRIORITY_NORMAL or PRIORITY_BACKGROUND.\n",
+               nullptr, false, false) {
+    return (ArObject *) IntNew((IntegerUnderlying) argon::vm::GetFiberPriority());
+}
+
+ARGON_FUNCTION(runtime_profile_dump, profile_dump,
+               "Dump the data collected by the profiler.\n"
+               "\n"
+               "The JSON format contains per-opcode execution counts and, for each code object, "
+               "the number of calls, self/total time (microseconds) and per-line hit counts. "
+               "The collapsed format contains one line for each sampled call stack (f1;f2;f3 microseconds) "
+               "and can be used to build flame graphs.\n"
+               "\n"
+               "- Parameter format: Output format, \"json\" or \"collapsed\".\n"
+               "- Returns: String containing the dump.\n",
+               "s: format", false, false) {
+    const auto *format = (String *) *args;
+
+    if (StringEqual(format, "json"))
+        return (ArObject *) argon::vm::profiler::DumpJSON();
+
+    if (StringEqual(format, "collapsed"))
+        return (ArObject *) argon::vm::profiler::DumpCollapsed();
+
+    ErrorFormat(kValueError[0], "unknown profiler dump format '%s' (expected json or collapsed)",
+                ARGON_RAW_STRING(format));
+
+    return nullptr;
+}
+
+ARGON_FUNCTION(runtime_profile_reset, profile_reset,
+               "Reset the data collected by the profiler.\n",
+               nullptr, false, false) {
+    argon::vm::profiler::Reset();
+
+    return (ArObject *) IncRef(Nil);
+}
+
+ARGON_FUNCTION(runtime_profile_start, profile_start,
+               "Start the opcode-level execution profiler, data collected by a previous session are discarded.\n"
+               "\n"
+               "- Returns: Profiler status before this call.\n",
+               nullptr, false, false) {
+    if (!argon::vm::profiler::IsAvailable()) {
+        ErrorFormat(kRuntimeError[0], "profiler support was not compiled in (see ARGON_FF_PROFILER)");
+        return nullptr;
+    }
+
+    return BoolToArBool(argon::vm::profiler::Enable(true));
+}
+
+ARGON_FUNCTION(runtime_profile_stop, profile_stop,
+               "Stop the opcode-level execution profiler, collected data are preserved until the next start.\n"
+               "\n"
+               "- Returns: Profiler status before this call.\n",
+               nullptr, false, false) {
+    return BoolToArBool(argon::vm::profiler::Enable(false));
+}
+
+ARGON_FUNCTION(runtime_set_priority, set_priority,
+               "Set the priority class of the current fiber.\n"
+               "\n"
+               "Interactive fibers run before normal ones, background fibers run only when the VM has nothing "
+               "else to do. To prevent starvation, the lower classes periodically take precedence. "
+               "Fibers spawned afterwards inherit the new class.\n"
+               "\n"
+               "- Parameter priority: One of PRIORITY_INTERACTIVE, PRIORITY_NORMAL or PRIORITY_BACKGROUND.\n"
+               "- Returns: Previous priority class.\n",
+               "i: priority", false, false) {
+    auto priority = ((Integer *) args[0])->sint;
+
+    if (!CheckPriority(priority))
+        return nullptr;
+
+    auto *ret = IntNew((IntegerUnderlying) argon::vm::GetFiberPriority());
+    if (ret == nullptr)
+        return nullptr;
+
+    argon::vm::SetFiberPriority((argon::vm::FiberPriority) priority);
+
+    return (ArObject *) ret;
+}
+
+ARGON_FUNCTION(runtime_spawn_fiber, spawn_fiber,
+               "Run a function in a new fiber, like the spawn statement.\n"
+               "\n"
+               "Unlike the spawn statement, it allows tuning the stack of the new fiber.\n"
+               "\n"
+               "- Parameters:\n"
+               "    - func: function to call.\n"
+               "    - ...obj: arguments.\n"
+               "- KWParameters:\n"
+               "  - stack: size in bytes of the first stack segment allocated when the fiber "
+               "outgrows its initial stack (0: default).\n"
+               "  - priority: priority class of the new fiber (default: priority class of the current fiber).\n"
+               "- Returns: nil.\n",
+               "F: func", true, kFunctionKWArgsView) {
+    auto *func = (Function *) args[0];
+    IntegerUnderlying chunk_size;
+    IntegerUnderlying priority;
+
+    if (!KParamLookupInt((Dict *) kwargs, "stack", &chunk_size, 0))
+        return nullptr;
+
+    if (!KParamLookupInt((Dict *) kwargs, "priority", &priority, (IntegerUnderlying) argon::vm::GetFiberPriority()))
+        return nullptr;
+
+    if (!CheckPriority(priority))
+        return nullptr;
+
+    if (chunk_size < 0 || chunk_size > argon::vm::kFiberChunkSizeMax * 16) {
+        ErrorFormat(kValueError[0], "invalid stack segment size. Expected a value between 0 and %u, got: %lld",
+                    argon::vm::kFiberChunkSizeMax * 16, chunk_size);
+        return nullptr;
+    }
+
+    if (!FunctionCheckSpawnable(func, argc - 1))
+        return nullptr;
+
+    if (!argon::vm::Spawn(func, args + 1, argc - 1, argon::vm::OpCodeCallMode::FASTCALL,
+                          (unsigned int) chunk_size, (argon::vm::FiberPriority) priority))
+        return nullptr;
+
+    return (ArObject *) IncRef(Nil);
+}
+
+ARGON_FUNCTION(runtime_schedstats, schedstats,
+               "Get a snapshot of the scheduler statistics.\n"
+               "\n"
+               "The snapshot contains the depth of the global run queue, per VCore counters (run queue depth, "
+               "fibers executed, local/global/stolen dequeues, failed steals, local queue overflows and "
+               "a runnable-to-running latency histogram in power of two microsecond buckets) and "
+               "per OS thread counters (parks, unparks and spinning time).\n"
+               "\n"
+               "- Returns: JSON string.\n",
+               nullptr, false, false) {
+    return (ArObject *) argon::vm::SchedStatsDump();
+}
+
 bool ExposeConfig(Module *self) {
 #define PUT_BOOL(name, field)                                               \
      if (!DictInsert(ret, #name, (ArObject *) (field ? True : False))) {    \
@@ -56,6 +215,7 @@ bool ExposeConfig(Module *self) {
 
     ArObject *tmp;
 
+    PUT_BOOL(affinity, conf->affinity)
     PUT_BOOL(interactive, conf->interactive)
     PUT_BOOL(nogc, conf->nogc)
     PUT_BOOL(quiet, conf->quiet)
@@ -67,6 +227,9 @@ bool ExposeConfig(Module *self) {
     PUT_INT(fiber_ss, conf->fiber_ss)
     PUT_INT(fiber_pool, conf->fiber_pool)
     PUT_INT(optim_lvl, conf->optim_lvl)
+    PUT_INT(time_slice, conf->time_slice)
+    PUT_INT(schedstats, conf->schedstats)
+    PUT_INT(jit, conf->jit)
 
     if (!ModuleAddObject(self, "config", (ArObject *) ret, MODULE_ATTRIBUTE_DEFAULT)) {
         Release(ret);
@@ -179,6 +342,14 @@ bool SetOsName(Module *self) {
 }
 
 bool RuntimeInit(Module *self) {
+#define ADD_CONSTANT(name, value)                   \
+    if(!ModuleAddIntConstant(self, name, value))    \
+        return false
+
+    ADD_CONSTANT("PRIORITY_INTERACTIVE", (int) argon::vm::FiberPriority::INTERACTIVE);
+    ADD_CONSTANT("PRIORITY_NORMAL", (int) argon::vm::FiberPriority::NORMAL);
+    ADD_CONSTANT("PRIORITY_BACKGROUND", (int) argon::vm::FiberPriority::BACKGROUND);
+
     if (!ExposeConfig(self))
         return false;
 
@@ -216,6 +387,15 @@ Tuple *ParseCMDArgs(int argc, char **argv) {
 }
 
 const ModuleEntry runtime_entries[] = {
+        MODULE_EXPORT_FUNCTION(runtime_get_priority),
+        MODULE_EXPORT_FUNCTION(runtime_profile_dump),
+        MODULE_EXPORT_FUNCTION(runtime_profile_reset),
+        MODULE_EXPORT_FUNCTION(runtime_profile_start),
+        MODULE_EXPORT_FUNCTION(runtime_profile_stop),
+        MODULE_EXPORT_FUNCTION(runtime_schedstats),
+        MODULE_EXPORT_FUNCTION(runtime_set_priority),
+        MODULE_EXPORT_FUNCTION(runtime_spawn_fiber),
+
         ARGON_MODULE_SENTINEL
 };
 
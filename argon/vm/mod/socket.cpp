@@ -21,6 +21,8 @@
 
 #include <argon/vm/io/socket/socket.h>
 
+#include <argon/vm/runtime.h>
+
 #include <argon/vm/mod/modules.h>
 
 #undef CONST
@@ -68,7 +70,13 @@ ARGON_FUNCTION(socket_getaddrinfo, getaddrinfo,
     hints.ai_socktype = (int) ((Integer *) args[3])->sint;
     hints.ai_flags = (int) ((Integer *) args[4])->sint;
 
-    if ((retval = getaddrinfo((const char *) ARGON_RAW_STRING((String *) args[0]), service, &hints, &result)) != 0) {
+    argon::vm::EnterBlocking();
+
+    retval = getaddrinfo((const char *) ARGON_RAW_STRING((String *) args[0]), service, &hints, &result);
+
+    argon::vm::LeaveBlocking();
+
+    if (retval != 0) {
         ErrorFormat(kGAIError[0], "%s", gai_strerror(retval));
         return nullptr;
     }
@@ -278,8 +286,14 @@ ARGON_FUNCTION(socket_getnameinfo, getnameinfo,
 
     sbuf = hbuf + NI_MAXHOST;
 
-    if (getnameinfo(addr_ptr, sizeof(sockaddr), hbuf, NI_MAXHOST, sbuf, NI_MAXSERV,
-                    (int) ((Integer *) args[1])->sint) != 0) {
+    argon::vm::EnterBlocking();
+
+    auto retval = getnameinfo(addr_ptr, sizeof(sockaddr), hbuf, NI_MAXHOST, sbuf, NI_MAXSERV,
+                              (int) ((Integer *) args[1])->sint);
+
+    argon::vm::LeaveBlocking();
+
+    if (retval != 0) {
         argon::vm::memory::Free(hbuf);
 
         ErrorFromSocket();
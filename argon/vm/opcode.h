@@ -5,6 +5,8 @@
 #ifndef ARGON_VM_OPCODE_H_
 #define ARGON_VM_OPCODE_H_
 
+#include <atomic>
+
 #include <argon/util/enum_bitmask.h>
 
 namespace argon::vm {
@@ -104,7 +106,25 @@ namespace argon::vm {
         TSTORE,
         UNPACK,
         UNSYNC,
-        YLD
+        YLD,
+
+        // Specialized forms, they are never emitted by the compiler but are written
+        // by the interpreter in place of the generic instruction (quickening).
+        ADD_INT_INT,
+        CMP_INT_INT,
+        IPADD_INT,
+        IPADD_STR,
+        MUL_INT_INT,
+        SUB_INT_INT,
+
+        // Superinstructions, they replace the first instruction of a common pair (see FuseOpCode).
+        // The second instruction is left in place and is executed without being dispatched,
+        // so the layout of the bytecode does not change and jumps to the second instruction remain valid.
+        CMP_JF,
+        LDLC_LDATTR,
+        LDLC_LDLC,
+        LDMETH_CALL,
+        PSHC_POP
     };
 
     constexpr short StackChange[] = {
@@ -190,6 +210,17 @@ namespace argon::vm {
             -2,
             -1,
             0,
+            -1,
+            -1,
+            -1,
+            -1,
+            -1,
+            -1,
+            -1,
+            -1,
+            1,
+            1,
+            1,
             -1
     };
 
@@ -276,9 +307,96 @@ namespace argon::vm {
             2,
             2,
             1,
+            1,
+            1,
+            2,
+            1,
+            1,
+            1,
+            1,
+            2,
+            2,
+            2,
+            4,
             1
     };
 
+    /**
+     * @brief Returns the superinstruction that can replace the first instruction of a pair.
+     *
+     * @param first Opcode of the first instruction (quickened forms are accepted).
+     * @param second Opcode of the instruction that immediately follows.
+     * @return Superinstruction opcode, or first if the pair cannot be fused.
+     */
+    constexpr OpCode FuseOpCode(OpCode first, OpCode second) {
+        switch (first) {
+            case OpCode::CMP:
+            case OpCode::CMP_INT_INT:
+                return second == OpCode::JF ? OpCode::CMP_JF : first;
+            case OpCode::LDLC:
+                if (second == OpCode::LDATTR)
+                    return OpCode::LDLC_LDATTR;
+
+                return second == OpCode::LDLC || second == OpCode::LDLC_LDATTR || second == OpCode::LDLC_LDLC
+                       ? OpCode::LDLC_LDLC : first;
+            case OpCode::LDMETH:
+                return second == OpCode::CALL ? OpCode::LDMETH_CALL : first;
+            case OpCode::PSHC:
+                return second == OpCode::POP ? OpCode::PSHC_POP : first;
+            default:
+                return first;
+        }
+    }
+
+    /**
+     * @brief Returns the generic instruction that a quickened opcode specializes.
+     *
+     * @param op Opcode.
+     * @return Generic opcode, or op if it is not a quickened form.
+     */
+    constexpr OpCode GenericOpCode(OpCode op) {
+        switch (op) {
+            case OpCode::ADD_INT_INT:
+                return OpCode::ADD;
+            case OpCode::CMP_INT_INT:
+                return OpCode::CMP;
+            case OpCode::IPADD_INT:
+            case OpCode::IPADD_STR:
+                return OpCode::IPADD;
+            case OpCode::MUL_INT_INT:
+                return OpCode::MUL;
+            case OpCode::SUB_INT_INT:
+                return OpCode::SUB;
+            default:
+                return op;
+        }
+    }
+
+    static_assert(sizeof(std::atomic<unsigned char>) == sizeof(unsigned char));
+
+    /**
+     * @brief Reads the opcode of an instruction.
+     *
+     * Opcodes can be rewritten while other fibers are executing the same code (quickening),
+     * for this reason they are always accessed atomically.
+     *
+     * @param instr Pointer to the instruction.
+     * @return Opcode.
+     */
+    inline OpCode LoadOpCode(const unsigned char *instr) {
+        return (OpCode) ((const std::atomic<unsigned char> *) instr)->load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Replaces the opcode of an instruction (see LoadOpCode).
+     *
+     * @param instr Pointer to the instruction.
+     * @param op New opcode, it must have the same layout as the current one.
+     */
+    inline void StoreOpCode(const unsigned char *instr, OpCode op) {
+        ((std::atomic<unsigned char> *) instr)->store((unsigned char) op, std::memory_order_relaxed);
+    }
+
     enum class OpCodeInitMode : unsigned char {
         POSITIONAL,
         KWARGS
@@ -287,7 +405,10 @@ namespace argon::vm {
     enum class OpCodeCallMode : unsigned char {
         FASTCALL = 0,
         REST_PARAMS = 1,
-        KW_PARAMS = 1 << 1u
+        KW_PARAMS = 1 << 1u,
+
+        // Used with KW_PARAMS: keyword values are on the stack followed by a tuple with their names (instead of a Dict)
+        KW_NAMES = 1 << 2u
     };
 
     enum class OpCodeContainsMode : unsigned char {
@@ -0,0 +1,652 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+#include <argon/vm/runtime.h>
+
+#include <argon/vm/memory/memory.h>
+
+#include <argon/vm/datatype/stringbuilder.h>
+
+#include <argon/vm/opcode.h>
+#include <argon/vm/profiler.h>
+
+using namespace argon::vm;
+using namespace argon::vm::datatype;
+using namespace argon::vm::profiler;
+
+using ProfClock = std::chrono::steady_clock;
+
+constexpr unsigned short kProfilerBuckets = 1024;
+
+constexpr ArSize kProfilerWriteOveralloc = 1024;
+
+constexpr const char *kOpCodeNames[] = {
+        "ADD", "AWAIT", "CALL", "CMP", "CNT", "DEC", "DFR", "DIV", "DTMERGE", "DUP", "EQST", "EXTD", "IDIV",
+        "IMPALL", "IMPFRM", "IMPMOD", "INC", "INIT", "INV", "IPADD", "IPSUB", "JEX", "JF", "JFOP", "JMP", "JNIL",
+        "JNN", "JT", "JTOP", "LAND", "LDATTR", "LDENC", "LDGBL", "LDITER", "LDLC", "LDMETH", "LDSCOPE", "LOR",
+        "LSTATIC", "LXOR", "MKBND", "MKDT", "MKFN", "MKLT", "MKST", "MKSTRUCT", "MKTP", "MKTRAIT", "MOD", "MTH",
+        "MUL", "NEG", "NGV", "NOT", "NXT", "PANIC", "PLT", "POP", "POPC", "POPGT", "POS", "PSHC", "PSHN", "RET",
+        "SHL", "SHR", "SPW", "ST", "STATTR", "STENC", "STGBL", "STLC", "STSCOPE", "STSUBSCR", "SUB", "SUBSCR",
+        "SYNC", "TEST", "TRAP", "TSTORE", "UNPACK", "UNSYNC", "YLD",
+        "ADD_INT_INT", "CMP_INT_INT", "IPADD_INT", "IPADD_STR", "MUL_INT_INT", "SUB_INT_INT",
+        "CMP_JF", "LDLC_LDATTR", "LDLC_LDLC", "LDMETH_CALL", "PSHC_POP"
+};
+constexpr auto kOpCodeCount = sizeof(kOpCodeNames) / sizeof(kOpCodeNames[0]);
+
+static_assert(kOpCodeCount == (unsigned char) OpCode::PSHC_POP + 1, "kOpCodeNames must list every opcode");
+
+using ProfCounter = std::atomic<unsigned long long>;
+
+struct argon::vm::profiler::ProfCode {
+    /// Next record in the same bucket.
+    ProfCode *next;
+
+    /// Profiled code (strong reference, released when the profiler is stopped, see DetachRecord).
+    Code *code;
+
+    /// Name of the profiled code, set when the record is detached from it.
+    String *name;
+
+    ProfCounter calls;
+
+    /// Time spent in this code (nanoseconds).
+    ProfCounter self_ns;
+
+    /// Time spent in this code and in the code called by it (nanoseconds).
+    ProfCounter total_ns;
+
+    /// Execution count for each instruction (indexed by offset), only while the record is attached to code.
+    ProfCounter *hits;
+
+    /// Hit counts folded by line as (line, hits) pairs, set when the record is detached from code.
+    unsigned long long *lines;
+
+    /// Number of pairs in lines.
+    unsigned int lines_sz;
+};
+
+struct StackNode {
+    /// Next sibling.
+    StackNode *next;
+
+    StackNode *child;
+
+    ProfCode *record;
+
+    /// Sampled time (nanoseconds).
+    unsigned long long weight_ns;
+};
+
+std::atomic_bool argon::vm::profiler::profiler_enabled = false;
+
+static std::atomic<ProfCode *> records[kProfilerBuckets];
+static std::mutex records_lock;
+
+static ProfCounter opcodes[kOpCodeCount];
+
+static StackNode stack_root{};
+static std::mutex stack_lock;
+
+// Serializes Enable, Reset and the dump functions
+static std::mutex session_lock;
+
+// Incremented on Enable/Reset, invalidates the sampling timestamp and the cached record of every OS thread
+static std::atomic_uint profiler_epoch = 0;
+
+// Number of threads inside TrackCall/TrackInstr, indexed by the parity of the epoch they entered with
+static std::atomic_uint profiler_active[2];
+
+thread_local ProfClock::time_point last_sample;
+thread_local unsigned int last_epoch;
+
+ProfCode *Lookup(const Code *code) {
+    auto &bucket = records[(((uintptr_t) code) >> 4) % kProfilerBuckets];
+
+    for (auto *cursor = bucket.load(std::memory_order_acquire); cursor != nullptr; cursor = cursor->next) {
+        if (cursor->code == code)
+            return cursor;
+    }
+
+    std::unique_lock _(records_lock);
+
+    for (auto *cursor = bucket.load(std::memory_order_relaxed); cursor != nullptr; cursor = cursor->next) {
+        if (cursor->code == code)
+            return cursor;
+    }
+
+    auto *record = (ProfCode *) memory::Calloc(sizeof(ProfCode));
+    if (record == nullptr)
+        return nullptr;
+
+    if (code->instr_sz > 0) {
+        record->hits = (ProfCounter *) memory::Calloc(sizeof(ProfCounter) * code->instr_sz);
+        if (record->hits == nullptr) {
+            memory::Free(record);
+            return nullptr;
+        }
+    }
+
+    record->code = IncRef((Code *) code);
+    record->next = bucket.load(std::memory_order_relaxed);
+
+    bucket.store(record, std::memory_order_release);
+
+    return record;
+}
+
+ProfCode *DetachBuckets() {
+    ProfCode *list = nullptr;
+
+    std::unique_lock _(records_lock);
+
+    for (auto &bucket: records) {
+        auto *cursor = bucket.exchange(nullptr, std::memory_order_acq_rel);
+
+        while (cursor != nullptr) {
+            auto *next = cursor->next;
+
+            cursor->next = list;
+            list = cursor;
+
+            cursor = next;
+        }
+    }
+
+    return list;
+}
+
+unsigned int EnterTrack() {
+    unsigned int epoch;
+
+    // See Synchronize
+    while (true) {
+        epoch = profiler_epoch.load();
+
+        profiler_active[epoch & 1].fetch_add(1);
+
+        if (profiler_epoch.load() == epoch)
+            return epoch;
+
+        profiler_active[epoch & 1].fetch_sub(1);
+    }
+}
+
+void LeaveTrack(unsigned int epoch) {
+    profiler_active[epoch & 1].fetch_sub(1, std::memory_order_release);
+}
+
+void Synchronize() {
+    // Threads that enter after the increment use the other counter, so this one eventually drops to zero
+    auto epoch = profiler_epoch.fetch_add(1);
+
+    while (profiler_active[epoch & 1].load(std::memory_order_acquire) != 0)
+        std::this_thread::yield();
+}
+
+bool DetachRecord(ProfCode *record) {
+    const auto *code = record->code;
+    unsigned int count = 0;
+    unsigned int last_line = 0;
+
+    if (code == nullptr)
+        return true;
+
+    for (unsigned int i = 0; i < code->instr_sz; i++) {
+        auto line = code->GetLineMapping(i);
+
+        if (record->hits[i].load(std::memory_order_relaxed) > 0 && (count == 0 || line != last_line)) {
+            last_line = line;
+            count++;
+        }
+    }
+
+    if (count > 0) {
+        record->lines = (unsigned long long *) memory::Calloc(sizeof(unsigned long long) * count * 2);
+        if (record->lines == nullptr)
+            return false;
+    }
+
+    // Consecutive instructions on the same line are merged (as in WriteLines)
+    count = 0;
+    for (unsigned int i = 0; i < code->instr_sz; i++) {
+        auto hits = record->hits[i].load(std::memory_order_relaxed);
+        auto line = code->GetLineMapping(i);
+
+        if (hits == 0)
+            continue;
+
+        if (count == 0 || line != record->lines[(count - 1) * 2]) {
+            record->lines[count * 2] = line;
+            count++;
+        }
+
+        record->lines[(count - 1) * 2 + 1] += hits;
+    }
+
+    record->lines_sz = count;
+    record->name = IncRef(code->qname != nullptr ? code->qname : code->name);
+
+    memory::Free(record->hits);
+    record->hits = nullptr;
+
+    Release(&record->code);
+
+    return true;
+}
+
+void FreeRecords(ProfCode *list) {
+    while (list != nullptr) {
+        auto *next = list->next;
+
+        Release(list->code);
+        Release(list->name);
+
+        memory::Free(list->hits);
+        memory::Free(list->lines);
+        memory::Free(list);
+
+        list = next;
+    }
+}
+
+void FreeStack(StackNode *node) {
+    while (node != nullptr) {
+        auto *next = node->next;
+
+        FreeStack(node->child);
+
+        memory::Free(node);
+
+        node = next;
+    }
+}
+
+void ResetLocked() {
+    auto *list = DetachBuckets();
+
+    // Wait for the threads that may still hold a pointer to one of the detached records
+    Synchronize();
+
+    std::unique_lock _(stack_lock);
+
+    FreeStack(stack_root.child);
+    stack_root.child = nullptr;
+
+    FreeRecords(list);
+
+    for (auto &counter: opcodes)
+        counter.store(0, std::memory_order_relaxed);
+}
+
+StackNode *GetChild(StackNode *node, ProfCode *record) {
+    StackNode *cursor;
+
+    for (cursor = node->child; cursor != nullptr; cursor = cursor->next) {
+        if (cursor->record == record)
+            return cursor;
+    }
+
+    if ((cursor = (StackNode *) memory::Calloc(sizeof(StackNode))) == nullptr)
+        return nullptr;
+
+    cursor->record = record;
+    cursor->next = node->child;
+
+    node->child = cursor;
+
+    return cursor;
+}
+
+void Sample(const Frame *frame) {
+    ProfCode *stack[kProfilerMaxDepth];
+    unsigned short depth = 0;
+
+    auto now = ProfClock::now();
+    auto epoch = profiler_epoch.load(std::memory_order_relaxed);
+
+    if (last_epoch != epoch) {
+        last_epoch = epoch;
+        last_sample = now;
+        return;
+    }
+
+    auto elapsed = (unsigned long long) std::chrono::duration_cast<std::chrono::nanoseconds>(now - last_sample).count();
+
+    last_sample = now;
+
+    // stack[0] is the innermost frame
+    for (auto *cursor = frame; cursor != nullptr && depth < kProfilerMaxDepth; cursor = cursor->back) {
+        if ((stack[depth] = Lookup(cursor->code)) == nullptr)
+            return;
+
+        depth++;
+    }
+
+    if (depth == 0)
+        return;
+
+    stack[0]->self_ns.fetch_add(elapsed, std::memory_order_relaxed);
+
+    for (unsigned short i = 0; i < depth; i++) {
+        unsigned short j = 0;
+
+        // Recursive calls are counted once
+        while (j < i && stack[j] != stack[i])
+            j++;
+
+        if (j == i)
+            stack[i]->total_ns.fetch_add(elapsed, std::memory_order_relaxed);
+    }
+
+    std::unique_lock _(stack_lock);
+
+    auto *node = &stack_root;
+    for (int i = depth - 1; i >= 0; i--) {
+        if ((node = GetChild(node, stack[i])) == nullptr)
+            return;
+    }
+
+    node->weight_ns += elapsed;
+}
+
+bool WriteFormat(StringBuilder &builder, const char *format, ...) {
+    char buffer[256];
+    va_list args;
+
+    va_start(args, format);
+    auto length = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+
+    // A truncated entry would corrupt the dump
+    if (length < 0 || length >= (int) sizeof(buffer))
+        return false;
+
+    return builder.Write((const unsigned char *) buffer, length, kProfilerWriteOveralloc);
+}
+
+bool WriteCodeName(StringBuilder &builder, const ProfCode *record) {
+    const auto *code = record->code;
+    const auto *name = record->name;
+
+    if (code != nullptr)
+        name = code->qname != nullptr ? code->qname : code->name;
+
+    if (name == nullptr)
+        return builder.Write((const unsigned char *) "<unknown>", 9, kProfilerWriteOveralloc);
+
+    return builder.WriteEscaped(ARGON_RAW_STRING(name), ARGON_RAW_STRING_LENGTH(name), kProfilerWriteOveralloc);
+}
+
+bool WriteCollapsed(StringBuilder &builder, const StackNode *node, const StackNode **path, unsigned short depth) {
+    for (auto *cursor = node; cursor != nullptr; cursor = cursor->next) {
+        path[depth] = cursor;
+
+        if (cursor->weight_ns / 1000 > 0) {
+            for (unsigned short i = 0; i <= depth; i++) {
+                if (i > 0 && !builder.Write((const unsigned char *) ";", 1, kProfilerWriteOveralloc))
+                    return false;
+
+                if (!WriteCodeName(builder, path[i]->record))
+                    return false;
+            }
+
+            if (!WriteFormat(builder, " %llu\n", cursor->weight_ns / 1000))
+                return false;
+        }
+
+        if (depth + 1 < kProfilerMaxDepth && !WriteCollapsed(builder, cursor->child, path, depth + 1))
+            return false;
+    }
+
+    return true;
+}
+
+bool WriteLines(StringBuilder &builder, const ProfCode *record) {
+    const auto *code = record->code;
+    unsigned int last_line = 0;
+    unsigned long long line_hits = 0;
+    bool first = true;
+
+    if (!builder.Write((const unsigned char *) "{", 1, kProfilerWriteOveralloc))
+        return false;
+
+    if (code == nullptr) {
+        for (unsigned int i = 0; i < record->lines_sz; i++) {
+            if (!WriteFormat(builder, "%s\"%llu\": %llu", i == 0 ? "" : ", ",
+                             record->lines[i * 2], record->lines[i * 2 + 1]))
+                return false;
+        }
+
+        return builder.Write((const unsigned char *) "}", 1, kProfilerWriteOveralloc);
+    }
+
+    // Lines are emitted in bytecode order, consecutive instructions on the same line are merged
+    for (unsigned int i = 0; i <= code->instr_sz; i++) {
+        unsigned long long hits = 0;
+        unsigned int line = 0;
+
+        if (i < code->instr_sz) {
+            if ((hits = record->hits[i].load(std::memory_order_relaxed)) == 0)
+                continue;
+
+            line = code->GetLineMapping(i);
+        }
+
+        if (line_hits > 0 && (line != last_line || i == code->instr_sz)) {
+            if (!WriteFormat(builder, "%s\"%u\": %llu", first ? "" : ", ", last_line, line_hits))
+                return false;
+
+            first = false;
+            line_hits = 0;
+        }
+
+        last_line = line;
+        line_hits += hits;
+    }
+
+    return builder.Write((const unsigned char *) "}", 1, kProfilerWriteOveralloc);
+}
+
+String *DumpError(StringBuilder &builder) {
+    auto *err = builder.GetError();
+
+    // WriteFormat can fail without setting an error in the builder (vsnprintf)
+    if (err == nullptr) {
+        ErrorFormat(kRuntimeError[0], "unable to write the profiler dump");
+        return nullptr;
+    }
+
+    Panic((ArObject *) err);
+
+    Release(err);
+
+    return nullptr;
+}
+
+String *BuildString(StringBuilder &builder) {
+    auto *ret = builder.BuildString();
+
+    // If StringNew failed the panic is already set
+    if (ret == nullptr && !IsPanicking())
+        DumpError(builder);
+
+    return ret;
+}
+
+bool argon::vm::profiler::IsAvailable() {
+#ifdef ARGON_FF_PROFILER
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool argon::vm::profiler::Enable(bool enable) {
+    if (enable && !IsAvailable())
+        return false;
+
+    std::unique_lock _(session_lock);
+
+    if (profiler_enabled.load() == enable)
+        return enable;
+
+    if (enable) {
+        // A new session starts, discard the data of the previous one
+        ResetLocked();
+
+        profiler_enabled.store(true);
+        profiler_epoch.fetch_add(1);
+
+        return false;
+    }
+
+    profiler_enabled.store(false);
+
+    Synchronize();
+
+    // Keep the collected data, but release the code objects (and the modules that they keep alive)
+    for (auto &bucket: records) {
+        for (auto *cursor = bucket.load(std::memory_order_acquire); cursor != nullptr; cursor = cursor->next) {
+            if (!DetachRecord(cursor)) {
+                DiscardLastPanic();
+
+                ResetLocked();
+                break;
+            }
+        }
+    }
+
+    return true;
+}
+
+String *argon::vm::profiler::DumpCollapsed() {
+    const StackNode *path[kProfilerMaxDepth];
+    StringBuilder builder;
+
+    std::unique_lock session(session_lock);
+    std::unique_lock _(stack_lock);
+
+    if (!WriteCollapsed(builder, stack_root.child, path, 0))
+        return DumpError(builder);
+
+    return BuildString(builder);
+}
+
+String *argon::vm::profiler::DumpJSON() {
+    StringBuilder builder;
+    bool first = true;
+
+    std::unique_lock _(session_lock);
+
+    if (!builder.Write((const unsigned char *) "{\"opcodes\": {", 13, kProfilerWriteOveralloc))
+        return DumpError(builder);
+
+    for (unsigned int i = 0; i < kOpCodeCount; i++) {
+        auto count = opcodes[i].load(std::memory_order_relaxed);
+
+        if (count > 0) {
+            if (!WriteFormat(builder, "%s\"%s\": %llu", first ? "" : ", ", kOpCodeNames[i], count))
+                return DumpError(builder);
+
+            first = false;
+        }
+    }
+
+    if (!builder.Write((const unsigned char *) "}, \"codes\": [", 13, kProfilerWriteOveralloc))
+        return DumpError(builder);
+
+    first = true;
+    for (auto &bucket: records) {
+        for (auto *cursor = bucket.load(std::memory_order_acquire); cursor != nullptr; cursor = cursor->next) {
+            auto calls = cursor->calls.load(std::memory_order_relaxed);
+            auto self_ns = cursor->self_ns.load(std::memory_order_relaxed);
+            auto total_ns = cursor->total_ns.load(std::memory_order_relaxed);
+
+            if (!WriteFormat(builder, "%s{\"name\": \"", first ? "" : ", ")
+                || !WriteCodeName(builder, cursor)
+                || !WriteFormat(builder, "\", \"calls\": %llu, \"self_us\": %llu, \"total_us\": %llu, \"lines\": ",
+                                calls, self_ns / 1000, total_ns / 1000)
+                || !WriteLines(builder, cursor)
+                || !builder.Write((const unsigned char *) "}", 1, kProfilerWriteOveralloc))
+                return DumpError(builder);
+
+            first = false;
+        }
+    }
+
+    if (!builder.Write((const unsigned char *) "]}", 2, 0))
+        return DumpError(builder);
+
+    return BuildString(builder);
+}
+
+void argon::vm::profiler::EnterEval(ProfState *state) {
+    state->code = nullptr;
+    state->record = nullptr;
+    state->epoch = 0;
+    state->ticks = 0;
+
+    last_epoch = profiler_epoch.load(std::memory_order_relaxed);
+    last_sample = ProfClock::now();
+}
+
+void argon::vm::profiler::Reset() {
+    std::unique_lock _(session_lock);
+
+    ResetLocked();
+}
+
+void argon::vm::profiler::TrackCall(const Code *code) {
+    auto epoch = EnterTrack();
+
+    if (profiler_enabled.load()) {
+        auto *record = Lookup(code);
+
+        if (record != nullptr)
+            record->calls.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    LeaveTrack(epoch);
+}
+
+void argon::vm::profiler::TrackInstr(ProfState *state, const Frame *frame) {
+    const auto *code = frame->code;
+    auto epoch = EnterTrack();
+
+    // The profiler was stopped after the caller checked IsEnabled
+    if (!profiler_enabled.load()) {
+        LeaveTrack(epoch);
+        return;
+    }
+
+    // Records may have been released by Enable/Reset, the cached one is valid only within the same epoch
+    if (state->code != code || state->epoch != epoch) {
+        state->code = code;
+        state->epoch = epoch;
+        state->record = Lookup(code);
+    }
+
+    opcodes[(unsigned char) LoadOpCode(frame->instr_ptr)].fetch_add(1, std::memory_order_relaxed);
+
+    if (state->record != nullptr) {
+        auto offset = (ArSize) (frame->instr_ptr - code->instr);
+
+        if (offset < code->instr_sz)
+            state->record->hits[offset].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (++state->ticks >= kProfilerSampleInterval) {
+        state->ticks = 0;
+
+        Sample(frame);
+    }
+
+    LeaveTrack(epoch);
+}
@@ -20,90 +20,165 @@
 
 #include <atomic>
 #include <cassert>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdio>
 #include <random>
 
+#include <stratum/osmemory.h>
+
 #include <argon/lang/compiler_wrapper.h>
 
 #include <argon/vm/datatype/atom.h>
 #include <argon/vm/datatype/error.h>
 #include <argon/vm/datatype/future.h>
+#include <argon/vm/datatype/stringbuilder.h>
+#include <argon/vm/datatype/taskgroup.h>
 
 #include <argon/vm/loop2/evloop.h>
 #include <argon/vm/sync/mcond.h>
+#include <argon/vm/sync/parker.h>
 
 #include <argon/vm/setup.h>
 
 #include <argon/vm/areval.h>
+#include <argon/vm/fdeque.h>
 #include <argon/vm/fiber.h>
 #include <argon/vm/fqueue.h>
+#include <argon/vm/jit.h>
 #include <argon/vm/runtime.h>
+#include <argon/vm/schedstats.h>
 #include <argon/vm/signal.h>
+#include <argon/vm/topology.h>
 #include <argon/vm/traceback.h>
 
 using namespace argon::vm;
 using namespace argon::vm::datatype;
 
+#ifdef ARGON_FF_MUTEX_RUNQUEUE
+using VCoreQueue = FiberQueue;
+#else
+using VCoreQueue = FiberDeque<kVCoreQueueLengthMax>;
+#endif
+
+#ifdef ARGON_FF_SCHEDSTATS
+#define MARK_RUNNABLE(fiber)    (fiber)->runnable_ns = schedstats::Now()
+#else
+#define MARK_RUNNABLE(fiber)    ((void) 0)
+#endif
+
 struct VCore {
     VCore *next;
     VCore **prev;
 
-    FiberQueue queue;
+    // Only NORMAL fibers are kept in the local queue, the other classes always go through the global queues
+    VCoreQueue queue;
+
+    schedstats::VCoreStats stats;
+
+    // Dispatches since the lower classes were last given precedence (see FindExecutable)
+    unsigned int aging;
+
+    // CPU the OSThread that wires this VCore is pinned to (-1 = no affinity)
+    int cpu;
+
+    // NUMA node of the CPU, StealWork prefers victims on the same node
+    int node;
+
+    // Set with a CAS by the thread that takes the VCore, cleared by the thread that releases it
+    std::atomic_bool wired;
+
+    // The VCore is linked in vcores_active (read and written only by the thread that won the wired CAS)
+    bool listed;
 
-    bool wired;
     bool stealing;
 };
 
 struct OSThread {
-    OSThread *next;
-    OSThread **prev;
-
     Fiber *fiber;
     FiberStatus fiber_status;
 
     VCore *current;
     VCore *old;
 
+    sync::Parker parker;
+
+    schedstats::OSThreadStats stats;
+
+    // Magazine of recycled fibers, it refills from and spills to fiber_pool in batches
+    Fiber *fibers[kFiberMagazineSize];
+    unsigned int fibers_count;
+
+    // CPU this thread is currently pinned to (-1 = none)
+    int cpu;
+
+    // Index of this OSThread in ost_slots
+    unsigned int slot;
+
+    // Next parked OSThread in the idle stack (slot + 1, 0 = none)
+    std::atomic_uint idle_next;
+
     bool idle;
     bool spinning;
 
+    // Next thread in vc_waiters (see LeaveBlocking)
+    OSThread *vc_next;
+
+    // The thread released its VCore to run a blocking system call (see EnterBlocking)
+    bool blocking;
+
     std::thread self;
 };
 
 // OSThread variables
-OSThread *ost_active = nullptr;             // Working OSThread
-OSThread *ost_idle = nullptr;               // IDLE OSThread
+OSThread **ost_slots = nullptr;             // All OSThreads ever created (indexed by OSThread::slot)
 thread_local OSThread *ost_local = nullptr; // OSThread for actual thread
 
+// Lock-free stack of parked OSThreads: the low 32 bits hold the slot + 1 of the top (0 = empty),
+// the high 32 bits are a counter incremented on every change to prevent ABA
+std::atomic_uint64_t ost_idle = 0;
+
 unsigned int ost_total = 0;                 // OSThread counter
-unsigned int ost_idle_count = 0;            // OSThread counter (idle)
+unsigned int ost_slot_count = 0;            // Used entries in ost_slots
 unsigned int ost_max = 0;                   // Maximum OS thread allowed
 
+std::atomic_uint ost_idle_count = 0;        // OSThread counter (idle)
 std::atomic_uint ost_spinning_count = 0;    // OSThread in spinning
 std::atomic_uint ost_worker_count = 0;      // OSThread counter (worker)
 
-bool should_stop = false;
+std::atomic_bool should_stop = false;
 
 std::mutex ost_lock;
-std::condition_variable ost_cond;
 
 // VCore variables
 VCore *vcores = nullptr;                    // List of instantiated VCore
 VCore *vcores_active = nullptr;             // List of suspended VCores that have at least 1 ArRoutine in the queue
 
 unsigned int vc_total = 0;                  // Maximum concurrent VCore
+unsigned int vc_nodes = 1;                  // NUMA nodes spanned by the VCores
 
 std::atomic_uint vc_idle_count = 0;         // IDLE VCore
 
 std::mutex vc_lock;
 
+// Threads back from a blocking call that found every VCore busy, VCoreRelease hands its VCore to the first one
+OSThread *vc_waiters = nullptr;             // Protected by vc_lock
+std::atomic_uint vc_waiters_count = 0;
+
 unsigned int fiber_stack_size = 0;          // Fiber stack size
+unsigned int time_slice = 0;                // Calls/backward jumps before preempting a fiber
+
+// Periodic dump of the scheduler statistics (see --schedstats)
+std::thread schedstats_thread;
+std::condition_variable schedstats_cond;
+std::mutex schedstats_lock;
 
 // Panic management
 struct Panic *panic_global = nullptr;
 std::atomic<struct Panic *> panic_oom = nullptr;
 
 // Global queues
-FiberQueue fiber_global;
+FiberQueue fiber_global[kFiberPriorityCount];   // One for each FiberPriority
 FiberQueue fiber_pool;
 
 // Prototypes
@@ -116,11 +191,9 @@ void OSTActive2Idle(OSThread *);
 
 void OSTIdle2Active(OSThread *);
 
-void OSTRemove(OSThread *);
+void OSTSleep(OSThread *);
 
-void OSTSleep();
-
-void PushOSThread(OSThread **, OSThread *);
+bool OSTWakeOne();
 
 void Scheduler(OSThread *);
 
@@ -128,18 +201,14 @@ void VCoreRelease(OSThread *);
 
 // Internal
 
+#define GLOBAL_QUEUE(priority)  fiber_global[(unsigned char) (priority)]
+
 #define ON_ARGON_CONTEXT                    \
     if (ost_local != nullptr)
 
 #define ON_EVENT_DISPATCHER \
     if(loop2::evloop_cur_fiber != nullptr)
 
-#define PUSH_LCQUEUE(vcore, fiber)          \
-    do {                                    \
-        if(!(vcore)->queue.Enqueue(fiber))  \
-            fiber_global.Enqueue(fiber);    \
-    } while(0)
-
 bool AcquireVCore(OSThread *ost) {
     for (VCore *cursor = vcores_active; cursor != nullptr; cursor = cursor->next) {
         if (WireVCore(ost, cursor))
@@ -154,7 +223,10 @@ bool AcquireVCore(OSThread *ost) {
     return false;
 }
 
-bool InitializeVCores(unsigned int n) {
+bool InitializeVCores(unsigned int n, bool affinity) {
+    CPUInfo *cpus = nullptr;
+    unsigned int cpu_count = 0;
+
     if (n == 0) {
         n = std::thread::hardware_concurrency();
         if (n == 0)
@@ -164,8 +236,28 @@ bool InitializeVCores(unsigned int n) {
     if ((vcores = (VCore *) memory::Calloc(sizeof(VCore) * n)) == nullptr)
         return false;
 
-    for (unsigned int i = 0; i < n; i++)
-        new(&(vcores + i)->queue)FiberQueue(kVCoreQueueLengthMax);
+    if (affinity && (cpus = (CPUInfo *) memory::Alloc(sizeof(CPUInfo) * kTopologyMaxCPUs)) != nullptr)
+        cpu_count = TopologyGetCPUs(cpus, kTopologyMaxCPUs);
+
+    for (unsigned int i = 0; i < n; i++) {
+#ifdef ARGON_FF_MUTEX_RUNQUEUE
+        new(&(vcores + i)->queue)VCoreQueue(kVCoreQueueLengthMax);
+#else
+        new(&(vcores + i)->queue)VCoreQueue();
+#endif
+
+        new(&(vcores + i)->wired) std::atomic_bool(false);
+
+        // CPUs are grouped by node, so are the VCores (contiguous VCores share the same node)
+        auto info = TopologyAssign(i, cpus, cpu_count);
+
+        (vcores + i)->cpu = info.cpu;
+        (vcores + i)->node = info.node;
+    }
+
+    vc_nodes = TopologyCountNodes(cpus, cpu_count, n);
+
+    memory::Free(cpus);
 
     vc_total = n;
     vc_idle_count = n;
@@ -173,13 +265,16 @@ bool InitializeVCores(unsigned int n) {
     return true;
 }
 
-bool WireVCore(OSThread *ost, VCore *vcore) {
-    if (vcore == nullptr || vcore->wired)
-        return false;
+bool ClaimVCore(VCore *vcore) {
+    bool expected = false;
 
-    vcore->wired = true;
+    return vcore != nullptr && vcore->wired.compare_exchange_strong(expected, true, std::memory_order_acquire,
+                                                                    std::memory_order_relaxed);
+}
 
-    if (vcore->prev != nullptr) {
+void BindVCore(OSThread *ost, VCore *vcore) {
+    // Unlinking from vcores_active requires vc_lock, the caller must hold it if vcore->listed is set
+    if (vcore->listed) {
         *(vcore->prev) = vcore->next;
 
         if (vcore->next != nullptr)
@@ -187,26 +282,85 @@ bool WireVCore(OSThread *ost, VCore *vcore) {
 
         vcore->next = nullptr;
         vcore->prev = nullptr;
+        vcore->listed = false;
     }
 
     ost->current = vcore;
     ost->old = nullptr;
 
     vc_idle_count--;
+}
+
+bool WireVCore(OSThread *ost, VCore *vcore) {
+    if (!ClaimVCore(vcore))
+        return false;
+
+    BindVCore(ost, vcore);
 
     return true;
 }
 
 Fiber *AllocFiber(Context *context) {
-    auto *fiber = fiber_pool.Dequeue();
+    auto *ost = ost_local;
+    Fiber *fiber = nullptr;
+
+    if (ost == nullptr)
+        fiber = fiber_pool.Dequeue();
+    else if (ost->fibers_count > 0) {
+        fiber = ost->fibers[--ost->fibers_count];
+
+        SCHEDSTAT_INC(ost->stats, fiber_hits);
+    } else if ((ost->fibers_count = fiber_pool.Dequeue(ost->fibers, kFiberMagazineSize / 2)) > 0) {
+        fiber = ost->fibers[--ost->fibers_count];
+
+        SCHEDSTAT_INC(ost->stats, fiber_refills);
+    }
 
     if (fiber != nullptr) {
         fiber->context = context;
+        fiber->priority = FiberPriority::NORMAL;
 
         return fiber;
     }
 
-    return FiberNew(context, fiber_stack_size);
+    if (ost != nullptr)
+        SCHEDSTAT_INC(ost->stats, fiber_misses);
+
+    if ((fiber = FiberNew(context, fiber_stack_size)) != nullptr)
+        fiber->priority = FiberPriority::NORMAL;
+
+    return fiber;
+}
+
+bool GlobalIsEmpty() {
+    for (auto &queue: fiber_global) {
+        if (!queue.IsEmpty())
+            return false;
+    }
+
+    return true;
+}
+
+void GlobalEnqueue(Fiber *fiber) {
+    GLOBAL_QUEUE(fiber->priority).Enqueue(fiber);
+}
+
+Fiber *GlobalDequeue(VCore *vcore, FiberPriority priority) {
+    auto *fiber = GLOBAL_QUEUE(priority).Dequeue();
+
+    if (fiber != nullptr)
+        SCHEDSTAT_INC(vcore->stats, global);
+
+    return fiber;
+}
+
+Fiber *LocalDequeue(VCore *vcore) {
+    auto *fiber = vcore->queue.Dequeue();
+
+    if (fiber != nullptr)
+        SCHEDSTAT_INC(vcore->stats, local);
+
+    return fiber;
 }
 
 Fiber *FindExecutable(bool lq_last) {
@@ -216,26 +370,39 @@ Fiber *FindExecutable(bool lq_last) {
     if (should_stop)
         return nullptr;
 
-    if (!lq_last) {
-        fiber = current->queue.Dequeue();
-        if (fiber != nullptr)
+    // Starvation protection: every kScheduleTickBeforeAging dispatches the lowest class that has work goes first
+    if (++current->aging >= kScheduleTickBeforeAging) {
+        current->aging = 0;
+
+        if ((fiber = GlobalDequeue(current, FiberPriority::BACKGROUND)) != nullptr)
+            return fiber;
+
+        if ((fiber = LocalDequeue(current)) != nullptr)
+            return fiber;
+
+        if ((fiber = GlobalDequeue(current, FiberPriority::NORMAL)) != nullptr)
             return fiber;
     }
 
-    // Check from global queue
-    if ((fiber = fiber_global.Dequeue()) != nullptr)
+    if ((fiber = GlobalDequeue(current, FiberPriority::INTERACTIVE)) != nullptr)
         return fiber;
 
-    if ((fiber = StealWork(ost_local)) != nullptr)
+    if (!lq_last && (fiber = LocalDequeue(current)) != nullptr)
         return fiber;
 
-    if (lq_last) {
-        fiber = current->queue.Dequeue();
-        if (fiber != nullptr)
-            return fiber;
+    // Check from global queue
+    if ((fiber = GlobalDequeue(current, FiberPriority::NORMAL)) != nullptr)
+        return fiber;
+
+    if ((fiber = StealWork(ost_local)) != nullptr) {
+        SCHEDSTAT_INC(current->stats, stolen);
+        return fiber;
     }
 
-    return nullptr;
+    if (lq_last && (fiber = LocalDequeue(current)) != nullptr)
+        return fiber;
+
+    return GlobalDequeue(current, FiberPriority::BACKGROUND);
 }
 
 Fiber *StealWork(OSThread *ost) {
@@ -243,41 +410,54 @@ Fiber *StealWork(OSThread *ost) {
 
     auto *cur_vc = ost->current;
 
-    std::unique_lock lock(ost_lock);
+    if (!ost->spinning) {
+        auto spinning = ost_spinning_count.load();
 
-    //                                                  ▼▼▼▼▼ Busy VCore ▼▼▼▼▼
-    if (!ost->spinning && (ost_spinning_count + 1) > (vc_total - vc_idle_count))
-        return nullptr;
+        do {
+            //                      ▼▼▼▼▼ Busy VCore ▼▼▼▼▼
+            if ((spinning + 1) > (vc_total - vc_idle_count))
+                return nullptr;
+        } while (!ost_spinning_count.compare_exchange_weak(spinning, spinning + 1));
 
-    if (!ost->spinning) {
         ost->spinning = true;
-        ost_spinning_count++;
-    }
 
-    lock.unlock();
+#ifdef ARGON_FF_SCHEDSTATS
+        ost->stats.spin_start = schedstats::Now();
+#endif
+    }
 
     // Steal work from other VCore
-    std::uniform_int_distribution<unsigned int> r_distrib(0, vc_total);
+    std::uniform_int_distribution<unsigned int> r_distrib(0, vc_total - 1);
 
     auto start = r_distrib(vc_random);
 
     cur_vc->stealing = true;
 
-    for (auto i = start; i < vc_total + (vc_total - start); i++) {
-        auto *target_vc = vcores + (i % vc_total);
-        if (target_vc == cur_vc || target_vc->stealing)
-            continue;
+    // Victims on the same NUMA node first, then all the others (only if there is more than one node)
+    Fiber *fiber = nullptr;
 
-        // Steal from queues that contain one or more items
-        auto *fiber = cur_vc->queue.StealDequeue(1, target_vc->queue);
-        if (fiber != nullptr) {
-            cur_vc->stealing = false;
-            return fiber;
-        }
+    TopologyVisitVictims(vc_total, vc_nodes, cur_vc - vcores, start,
+                         [](unsigned int index) { return vcores[index].node; },
+                         [cur_vc, &fiber](unsigned int index) {
+                             auto *target_vc = vcores + index;
+                             if (target_vc->stealing)
+                                 return false;
+
+                             // Steal from queues that contain one or more items
+                             fiber = cur_vc->queue.StealDequeue(1, target_vc->queue);
+
+                             return fiber != nullptr;
+                         });
+
+    if (fiber != nullptr) {
+        cur_vc->stealing = false;
+        return fiber;
     }
 
     cur_vc->stealing = false;
 
+    SCHEDSTAT_INC(cur_vc->stats, failed_steals);
+
     return nullptr;
 }
 
@@ -285,6 +465,10 @@ OSThread *AllocOST() {
     auto *ost = (OSThread *) memory::Calloc(sizeof(OSThread));
 
     if (ost != nullptr) {
+        new(&ost->parker) sync::Parker();
+        new(&ost->idle_next) std::atomic_uint(0);
+
+        ost->cpu = -1;
         ost->idle = true;
         new(&ost->self) std::thread();
     }
@@ -295,7 +479,7 @@ OSThread *AllocOST() {
 void AcquireOrSuspend(OSThread *ost, Fiber **last) {
     std::unique_lock lock(vc_lock);
 
-    while (ost->current == nullptr) {
+    while (ost->current == nullptr && !should_stop) {
         if (WireVCore(ost, ost->old) || AcquireVCore(ost)) {
             lock.unlock();
 
@@ -304,27 +488,60 @@ void AcquireOrSuspend(OSThread *ost, Fiber **last) {
         }
 
         if (*last != nullptr) {
-            fiber_global.Enqueue(*last);
+            GlobalEnqueue(*last);
             *last = nullptr;
         }
 
         lock.unlock();
         OSTActive2Idle(ost);
-        OSTSleep();
+        OSTSleep(ost);
         lock.lock();
     }
 }
 
+void SpillFibers(OSThread *ost, unsigned int count) {
+    // The oldest fibers are at the bottom of the magazine
+    if (!fiber_pool.Enqueue(ost->fibers, count)) {
+        for (unsigned int i = 0; i < count; i++)
+            FiberDel(ost->fibers[i]);
+    }
+
+    ost->fibers_count -= count;
+
+    for (unsigned int i = 0; i < ost->fibers_count; i++)
+        ost->fibers[i] = ost->fibers[i + count];
+}
+
 void FreeFiber(Fiber *fiber) {
+    auto *ost = ost_local;
+
     Release((ArObject **) &fiber->future);
+    Release((ArObject **) &fiber->group);
+
+    // Return the stack segments to the chunk cache of this thread, pooled fibers only keep their inline stack
+    FiberResetStack(fiber);
+
+    if (ost == nullptr) {
+        if (!fiber_pool.Enqueue(fiber))
+            FiberDel(fiber);
 
-    if (!fiber_pool.Enqueue(fiber))
-        FiberDel(fiber);
+        return;
+    }
+
+    if (ost->fibers_count == kFiberMagazineSize) {
+        SpillFibers(ost, kFiberMagazineSize / 2);
+
+        SCHEDSTAT_ADD(ost->stats, fiber_spills, kFiberMagazineSize / 2);
+    }
+
+    ost->fibers[ost->fibers_count++] = fiber;
 }
 
 void FreeOSThread(OSThread *ost) {
     if (ost != nullptr) {
         ost->self.~thread();
+        ost->idle_next.~atomic();
+        ost->parker.~Parker();
         memory::Free(ost);
     }
 }
@@ -333,13 +550,9 @@ void OSTActive2Idle(OSThread *ost) {
     if (ost->idle)
         return;
 
-    std::unique_lock lock(ost_lock);
-
     if (ost->current != nullptr)
         VCoreRelease(ost);
 
-    OSTRemove(ost);
-    PushOSThread(&ost_idle, ost);
     ost->idle = true;
 
     ost_idle_count++;
@@ -350,45 +563,87 @@ void OSTIdle2Active(OSThread *ost) {
     if (!ost->idle)
         return;
 
-    std::unique_lock lock(ost_lock);
-
-    OSTRemove(ost);
-    PushOSThread(&ost_active, ost);
     ost->idle = false;
 
     ost_idle_count--;
     ost_worker_count++;
 }
 
-void OSTRemove(OSThread *ost) {
-    if (ost->prev != nullptr)
-        *ost->prev = ost->next;
-    if (ost->next != nullptr)
-        ost->next->prev = ost->prev;
+OSThread *OSTIdlePop() {
+    auto head = ost_idle.load(std::memory_order_acquire);
+    std::uint64_t next;
+    OSThread *ost;
+
+    do {
+        auto index = (unsigned int) head;
+        if (index == 0)
+            return nullptr;
+
+        // OSThreads are never freed while the VM is running, reading a stale entry is harmless (the CAS will fail)
+        ost = ost_slots[index - 1];
+
+        next = (((head >> 32) + 1) << 32) | ost->idle_next.load(std::memory_order_relaxed);
+    } while (!ost_idle.compare_exchange_weak(head, next, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    return ost;
 }
 
-void OSTSleep() {
-    std::unique_lock lock(ost_lock);
-    ost_cond.wait(lock); // Wait forever
+void OSTIdlePush(OSThread *ost) {
+    auto head = ost_idle.load(std::memory_order_relaxed);
+    std::uint64_t next;
+
+    do {
+        ost->idle_next.store((unsigned int) head, std::memory_order_relaxed);
+
+        next = (((head >> 32) + 1) << 32) | (ost->slot + 1);
+    } while (!ost_idle.compare_exchange_weak(head, next, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void OSTSleep(OSThread *ost) {
+    SCHEDSTAT_INC(ost->stats, parks);
+
+    OSTIdlePush(ost);
+
+    // A wakeup issued before the push may have found the idle stack empty, check again now that we are visible.
+    // The woken thread may be this one, in that case Park returns immediately
+    if (should_stop || (vc_idle_count > 0 && !GlobalIsEmpty()))
+        OSTWakeOne();
+
+    // Returns only after another thread has popped this one from the idle stack
+    ost->parker.Park();
+}
+
+void OSTWakeAll() {
+    while (OSTWakeOne());
+}
+
+bool OSTWakeOne() {
+    auto *ost = OSTIdlePop();
+    if (ost == nullptr)
+        return false;
+
+    SCHEDSTAT_INC(ost->stats, unparks);
+
+    ost->parker.Unpark();
+
+    return true;
 }
 
 void OSTWakeRun() {
     OSThread *ost;
     bool acquired;
 
-    std::unique_lock v_lock(vc_lock);
+    if (vc_idle_count == 0 && GlobalIsEmpty())
+        return;
 
-    if (fiber_global.IsEmpty() && vc_idle_count == 0)
+    // Fast path: hand the work to a parked thread without touching vc_lock/ost_lock
+    if (OSTWakeOne())
         return;
 
+    std::unique_lock v_lock(vc_lock);
     std::unique_lock o_lock(ost_lock);
 
-    if (ost_idle != nullptr) {
-        ost_cond.notify_one();
-        return;
-    }
-
-    if ((ost_total + 1) > ost_max)
+    if ((ost_total + 1) > ost_max || ost_slot_count >= ost_max)
         return;
 
     if ((ost = AllocOST()) == nullptr) {
@@ -398,17 +653,19 @@ void OSTWakeRun() {
         assert(false);
     }
 
+    ost->slot = ost_slot_count;
+    ost_slots[ost_slot_count++] = ost;
+
     ost_total++;
 
     acquired = AcquireVCore(ost);
     v_lock.unlock();
 
-    if (!acquired) {
-        PushOSThread(&ost_idle, ost);
+    if (!acquired)
         ost_idle_count++;
-    } else {
+    else {
         ost->idle = false;
-        PushOSThread(&ost_active, ost);
+        ost_worker_count++;
     }
 
     ost->self = std::thread(Scheduler, ost);
@@ -443,7 +700,32 @@ void PanicOOM(Fiber *fiber, struct Panic **panic, ArObject *object) {
     *panic = tmp;
 }
 
+void DiscardGroupFiber(Fiber *fiber) {
+    FrameDelRec(fiber->frame);
+
+    fiber->frame = nullptr;
+
+    TaskGroupDone(fiber->group, fiber->group_index, nullptr, nullptr);
+
+    FreeFiber(fiber);
+}
+
 void PublishResult(Fiber *fiber, ArObject *result) {
+    // The panic of a task group fiber is propagated to the fiber that waits for the group
+    if (fiber->group != nullptr) {
+        if (result == nullptr) {
+            auto *error = argon::vm::GetLastError();
+
+            TaskGroupDone(fiber->group, fiber->group_index, nullptr, error);
+
+            Release(error);
+        } else
+            TaskGroupDone(fiber->group, fiber->group_index, result, nullptr);
+
+        FreeFiber(fiber);
+        return;
+    }
+
     if (result == nullptr && fiber->context->global_config->stack_trace) {
         auto *err = fiber->panic->object;
 
@@ -467,28 +749,151 @@ void PublishResult(Fiber *fiber, ArObject *result) {
     FreeFiber(fiber);
 }
 
-void PushOSThread(OSThread **list, OSThread *ost) {
-    if (*list == nullptr) {
-        ost->next = nullptr;
-        ost->prev = list;
-    } else {
-        ost->next = (*list);
+void OSTPin(OSThread *ost) {
+    const auto *vcore = ost->current;
+
+    // Even if pinning fails, don't try again until the thread wires a VCore bound to a different CPU
+    ost->cpu = vcore->cpu;
 
-        if ((*list) != nullptr)
-            (*list)->prev = &ost->next;
+    if (vcore->cpu < 0 || !TopologyPinThread(vcore->cpu))
+        return;
+
+    // Arenas reserved by this thread from now on will be backed by memory of the local node
+    stratum::os::SetPreferredNode(vcore->node);
+}
 
-        ost->prev = list;
+void PushLocalQueue(VCore *vcore, Fiber *fiber) {
+    if (fiber->priority != FiberPriority::NORMAL) {
+        GlobalEnqueue(fiber);
+        return;
     }
 
-    *list = ost;
+    if (vcore->queue.Enqueue(fiber))
+        return;
+
+    SCHEDSTAT_INC(vcore->stats, overflows);
+
+#ifdef ARGON_FF_MUTEX_RUNQUEUE
+    GlobalEnqueue(fiber);
+#else
+    // The local queue is full, move the oldest half of it to the global queue in a single batch
+    Fiber *batch[(kVCoreQueueLengthMax / 2) + 1];
+
+    auto count = vcore->queue.StealBatch(batch, kVCoreQueueLengthMax / 2);
+
+    batch[count++] = fiber;
+
+    GLOBAL_QUEUE(FiberPriority::NORMAL).Enqueue(batch, count);
+#endif
 }
 
-void ResetSpinning(OSThread *ost) {
+void StopSpinning(OSThread *ost) {
+#ifdef ARGON_FF_SCHEDSTATS
+    SCHEDSTAT_ADD(ost->stats, spinning_ns, schedstats::Now() - ost->stats.spin_start);
+#endif
+
     ost->spinning = false;
     ost_spinning_count--;
+}
+
+void ResetSpinning(OSThread *ost) {
+    StopSpinning(ost);
 
     if (vc_idle_count > 0)
-        ost_cond.notify_one();
+        OSTWakeOne();
+}
+
+bool SchedStatsWrite(StringBuilder &builder) {
+    schedstats::VCoreStats vc_totals{};
+    schedstats::OSThreadStats ost_totals{};
+
+    auto interactive = GLOBAL_QUEUE(FiberPriority::INTERACTIVE).Size();
+    auto normal = GLOBAL_QUEUE(FiberPriority::NORMAL).Size();
+    auto background = GLOBAL_QUEUE(FiberPriority::BACKGROUND).Size();
+
+    if (!schedstats::Write(builder, "{\"global_queue\": %u, \"global_classes\": [%u, %u, %u], \"vcores_idle\": %u, ",
+                           interactive + normal + background, interactive, normal, background,
+                           vc_idle_count.load()))
+        return false;
+
+    if (!schedstats::Write(builder, "\"threads_idle\": %u, \"threads_spinning\": %u, \"vcores\": [",
+                           ost_idle_count.load(), ost_spinning_count.load()))
+        return false;
+
+    for (unsigned int i = 0; i < vc_total; i++) {
+        auto *vcore = vcores + i;
+
+        if (!schedstats::Write(builder, "%s{\"id\": %u, \"cpu\": %d, \"node\": %d, \"wired\": %s, \"queue\": %u, ",
+                               i > 0 ? ", " : "", i, vcore->cpu, vcore->node, vcore->wired.load() ? "true" : "false",
+                               (unsigned int) vcore->queue.Size()))
+            return false;
+
+        if (!schedstats::WriteVCoreStats(builder, &vcore->stats) || !schedstats::Write(builder, "}"))
+            return false;
+
+        schedstats::Accumulate(&vc_totals, &vcore->stats);
+    }
+
+    if (!schedstats::Write(builder, "], \"threads\": ["))
+        return false;
+
+    // OSThreads are never freed while the VM is running, the lock only protects ost_slot_count
+    std::unique_lock lock(ost_lock);
+
+    for (unsigned int i = 0; i < ost_slot_count; i++) {
+        const auto *ost = ost_slots[i];
+
+        if (!schedstats::Write(builder, "%s{\"id\": %u, \"cpu\": %d, \"idle\": %s, \"spinning\": %s, ",
+                               i > 0 ? ", " : "", i, ost->cpu, ost->idle ? "true" : "false",
+                               ost->spinning ? "true" : "false"))
+            return false;
+
+        if (!schedstats::WriteOSThreadStats(builder, &ost->stats) || !schedstats::Write(builder, "}"))
+            return false;
+
+        schedstats::Accumulate(&ost_totals, &ost->stats);
+    }
+
+    lock.unlock();
+
+    if (!schedstats::Write(builder, "], \"totals\": {"))
+        return false;
+
+    if (!schedstats::WriteVCoreStats(builder, &vc_totals) || !schedstats::Write(builder, ", "))
+        return false;
+
+    if (!schedstats::WriteOSThreadStats(builder, &ost_totals))
+        return false;
+
+    return schedstats::Write(builder, "}}");
+}
+
+void SchedStatsDumper(unsigned int interval) {
+    bool stop;
+
+    do {
+        std::unique_lock lock(schedstats_lock);
+
+        stop = schedstats_cond.wait_for(lock, std::chrono::milliseconds(interval), []() {
+            return should_stop.load();
+        });
+
+        lock.unlock();
+
+        // The last dump is emitted at shutdown
+        StringBuilder builder;
+
+        if (!SchedStatsWrite(builder) || !schedstats::Write(builder, "\n"))
+            continue;
+
+        auto *stats = builder.BuildString();
+        if (stats != nullptr) {
+            fwrite(ARGON_RAW_STRING(stats), 1, ARGON_RAW_STRING_LENGTH(stats), stderr);
+            fflush(stderr);
+
+            Release(stats);
+        }
+    } while (!stop);
 }
 
 void Scheduler(OSThread *self) {
@@ -499,9 +904,17 @@ void Scheduler(OSThread *self) {
 
     ost_local = self;
 
+    FiberChunkCacheEnable();
+
     while (!should_stop) {
         AcquireOrSuspend(self, &last);
 
+        if (should_stop)
+            break;
+
+        if (self->current->cpu != self->cpu)
+            OSTPin(self);
+
         if (++tick >= kScheduleTickBeforeCheck) {
             self->fiber = FindExecutable(true);
             tick = 0;
@@ -510,8 +923,12 @@ void Scheduler(OSThread *self) {
 
         if (self->fiber == nullptr) {
             if (last == nullptr) {
+                // Don't hold a spinning slot while sleeping, it would keep the other threads from stealing
+                if (self->spinning)
+                    StopSpinning(self);
+
                 OSTActive2Idle(self);
-                OSTSleep();
+                OSTSleep(self);
 
                 continue;
             }
@@ -521,7 +938,7 @@ void Scheduler(OSThread *self) {
         }
 
         if (last != nullptr) {
-            PUSH_LCQUEUE(self->current, last);
+            PushLocalQueue(self->current, last);
             last = nullptr;
         }
 
@@ -536,6 +953,18 @@ void Scheduler(OSThread *self) {
             continue;
         }
 
+        // Fibers of a cancelled task group are discarded before they start
+        if (self->fiber->group_fresh) {
+            self->fiber->group_fresh = false;
+
+            if (self->fiber->group->cancelled) {
+                DiscardGroupFiber(self->fiber);
+
+                self->fiber = nullptr;
+                continue;
+            }
+        }
+
         self->fiber->active_ost = self;
 
         // EOL
@@ -547,14 +976,34 @@ void Scheduler(OSThread *self) {
 
         SetFiberStatus(FiberStatus::RUNNING);
 
+        SCHEDSTAT_INC(self->current->stats, executed);
+
+#ifdef ARGON_FF_SCHEDSTATS
+        if (self->fiber->runnable_ns > 0) {
+            schedstats::RecordLatency(&self->current->stats, schedstats::Now() - self->fiber->runnable_ns);
+            self->fiber->runnable_ns = 0;
+        }
+#endif
+
+        self->fiber->slice = time_slice;
+
         result = Eval(self->fiber);
 
+        self->fiber->slice = 0;
         self->fiber->active_ost = nullptr;
 
         if (self->fiber_status != FiberStatus::RUNNING) {
-            if (self->fiber_status == FiberStatus::SUSPENDED)
+            if (self->fiber_status == FiberStatus::SUSPENDED) {
+                MARK_RUNNABLE(self->fiber);
+
                 last = self->fiber;
 
+                // A thread back from a blocking call is waiting for a VCore, give it this one.
+                // The fiber is requeued by AcquireOrSuspend if no other VCore is available
+                if (vc_waiters_count > 0)
+                    VCoreRelease(self);
+            }
+
             self->fiber = nullptr;
             continue;
         }
@@ -573,19 +1022,54 @@ void Scheduler(OSThread *self) {
 
     OSTActive2Idle(self);
 
+    if (self->fibers_count > 0)
+        SpillFibers(self, self->fibers_count);
+
+    FiberChunkCacheFlush();
+
+    memory::GCThreadDetach();
+
+    // The OSThread memory is released by Cleanup, a concurrent OSTIdlePop may still read it
     std::unique_lock lock(ost_lock);
-    OSTRemove(self);
     self->self.detach();
-    FreeOSThread(self);
     ost_total--;
 }
 
+bool VCoreHandOff(OSThread *ost) {
+    OSThread *waiter;
+
+    {
+        std::unique_lock lock(vc_lock);
+
+        if ((waiter = vc_waiters) == nullptr)
+            return false;
+
+        vc_waiters = waiter->vc_next;
+        vc_waiters_count--;
+
+        // The VCore stays wired, it passes straight to the waiter with its local queue
+        waiter->current = ost->current;
+        waiter->old = nullptr;
+        waiter->vc_next = nullptr;
+
+        ost->old = nullptr;
+        ost->current = nullptr;
+    }
+
+    waiter->parker.Unpark();
+
+    return true;
+}
+
 void VCoreRelease(OSThread *ost) {
     auto *current = ost->current;
 
     if (current == nullptr)
         return;
 
+    if (vc_waiters_count > 0 && VCoreHandOff(ost))
+        return;
+
     ost->old = ost->current;
     ost->current = nullptr;
 
@@ -599,17 +1083,37 @@ void VCoreRelease(OSThread *ost) {
 
         *next = current;
         current->prev = next;
+        current->listed = true;
     }
 
-    current->wired = false;
     vc_idle_count++;
+
+    current->wired.store(false, std::memory_order_release);
+
+    // A thread may have started waiting after the check above, don't leave it waiting for an idle VCore
+    if (vc_waiters_count > 0) {
+        std::unique_lock lock(vc_lock);
+
+        auto *waiter = vc_waiters;
+
+        if (waiter != nullptr && WireVCore(waiter, current)) {
+            vc_waiters = waiter->vc_next;
+            vc_waiters_count--;
+
+            waiter->vc_next = nullptr;
+
+            lock.unlock();
+
+            waiter->parker.Unpark();
+        }
+    }
 }
 
 // Public
 
 ArObject *argon::vm::EvalRaiseError(Function *func, ArObject **argv, ArSize argc, OpCodeCallMode mode) {
     if (func->IsNative())
-        return FunctionInvokeNative(func, argv, argc, ENUMBITMASK_ISTRUE(mode, OpCodeCallMode::KW_PARAMS));
+        return FunctionInvokeNative(func, argv, argc, mode);
 
     auto *result = Eval(func, argv, argc, mode);
     if (result == nullptr)
@@ -631,7 +1135,7 @@ ArObject *argon::vm::EvalRaiseError(Function *func, ArObject **argv, ArSize argc
 
 argon::vm::datatype::ArObject *argon::vm::EvalSync(Function *func, ArObject **argv, ArSize argc, OpCodeCallMode mode) {
     if (func->IsNative())
-        return FunctionInvokeNative(func, argv, argc, ENUMBITMASK_ISTRUE(mode, OpCodeCallMode::KW_PARAMS));
+        return FunctionInvokeNative(func, argv, argc, mode);
 
     auto *fiber = GetFiber();
 
@@ -758,8 +1262,11 @@ Future *argon::vm::EvalAsync(Context *context, datatype::Function *func, datatyp
 
     fiber->future = IncRef(future);
     fiber->frame = frame;
+    fiber->priority = GetFiberPriority();
+
+    MARK_RUNNABLE(fiber);
 
-    fiber_global.Enqueue(fiber);
+    GlobalEnqueue(fiber);
 
     OSTWakeRun();
 
@@ -788,7 +1295,9 @@ Result *argon::vm::Eval(Context *context, Code *code, Namespace *ns) {
     fiber->future = IncRef(future);
     fiber->frame = frame;
 
-    fiber_global.Enqueue(fiber);
+    MARK_RUNNABLE(fiber);
+
+    GlobalEnqueue(fiber);
 
     OSTWakeRun();
 
@@ -932,10 +1441,17 @@ bool argon::vm::CheckLastPanic(const char *id) {
 }
 
 bool argon::vm::Initialize(const Config *config) {
+    if (config->huge_pages > 0)
+        memory::MemorySetArenaMode(config->huge_pages > 1
+                                   ? stratum::ArenaMode::HUGETLB
+                                   : stratum::ArenaMode::TRANSPARENT_HUGE_PAGES);
+
+    memory::MemorySetDecay(config->arena_decay > 0 ? config->arena_decay : 0);
+
     if (!memory::MemoryInit())
         return false;
 
-    if (!InitializeVCores(config->max_vc)) {
+    if (!InitializeVCores(config->max_vc, config->affinity)) {
         memory::MemoryFinalize();
         return false;
     }
@@ -952,14 +1468,34 @@ bool argon::vm::Initialize(const Config *config) {
     if (config->max_ost <= 0)
         ost_max = kOSThreadMax;
 
+    if ((ost_slots = (OSThread **) memory::Calloc(sizeof(void *) * ost_max)) == nullptr) {
+        memory::MemoryFinalize();
+        return false;
+    }
+
+    time_slice = config->time_slice;
+    if (config->time_slice < 0)
+        time_slice = kFiberTimeSlice;
+
+    // 0: disabled, < 0: default threshold
+    jit::jit_threshold = config->jit;
+    if (config->jit < 0)
+        jit::jit_threshold = jit::kJITDefaultThreshold;
+
     memory::GCEnable(!config->nogc);
 
     if (!Setup())
         return false;
 
+    if (!memory::GCStartCollector())
+        return false;
+
     if (!loop2::EvLoopInitRun())
         return false;
 
+    if (config->schedstats > 0)
+        schedstats_thread = std::thread(SchedStatsDumper, (unsigned int) config->schedstats);
+
     SignalProcMask();
 
     // TODO: panic_oom
@@ -991,18 +1527,36 @@ bool argon::vm::Shutdown() {
 
     loop2::Shutdown();
 
-    should_stop = true;
-    ost_cond.notify_all();
+    {
+        std::unique_lock lock(schedstats_lock);
+        should_stop = true;
+    }
+
+    schedstats_cond.notify_one();
+
+    OSTWakeAll();
 
     while (ost_total > 0 && attempt > 0) {
         std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+        // Threads that were going to sleep while should_stop was being set
+        OSTWakeAll();
         attempt--;
     }
 
+    if (schedstats_thread.joinable())
+        schedstats_thread.join();
+
+    memory::GCStopCollector();
+
+    // Releases the types and names retained by the allocation sites
+    memory::HeapProfStop();
+
     return ost_total == 0;
 }
 
-bool argon::vm::Spawn(Function *func, ArObject **argv, ArSize argc, OpCodeCallMode mode) {
+bool argon::vm::Spawn(Function *func, ArObject **argv, ArSize argc, OpCodeCallMode mode,
+                      unsigned int chunk_size, FiberPriority priority) {
     Fiber *fiber;
 
     assert(ost_local != nullptr);
@@ -1011,6 +1565,9 @@ bool argon::vm::Spawn(Function *func, ArObject **argv, ArSize argc, OpCodeCallMo
     if (fiber == nullptr)
         return false;
 
+    fiber->chunk_size = chunk_size;
+    fiber->priority = priority;
+
     auto *frame = FrameNew(fiber, func, argv, argc, mode);
     if (frame == nullptr) {
         FreeFiber(fiber);
@@ -1019,13 +1576,93 @@ bool argon::vm::Spawn(Function *func, ArObject **argv, ArSize argc, OpCodeCallMo
 
     FiberPushFrame(fiber, frame);
 
-    fiber_global.Enqueue(fiber);
+    MARK_RUNNABLE(fiber);
+
+    GlobalEnqueue(fiber);
 
     OSTWakeRun();
 
     return true;
 }
 
+bool argon::vm::SpawnGroup(TaskGroup *group, Tuple **calls, unsigned int count, unsigned int index) {
+    unsigned int created;
+
+    assert(ost_local != nullptr);
+
+    auto *batch = (Fiber **) memory::Alloc(count * sizeof(void *));
+    if (batch == nullptr)
+        return false;
+
+    auto *context = GetFiber()->context;
+    auto priority = GetFiberPriority();
+
+    for (created = 0; created < count; created++) {
+        auto *call = calls[created];
+
+        auto *fiber = AllocFiber(context);
+        if (fiber == nullptr)
+            break;
+
+        auto *frame = FrameNew(fiber, (Function *) call->objects[0], call->objects + 1, call->length - 1,
+                               OpCodeCallMode::FASTCALL);
+        if (frame == nullptr) {
+            FreeFiber(fiber);
+            break;
+        }
+
+        FiberPushFrame(fiber, frame);
+
+        fiber->group = IncRef(group);
+        fiber->group_index = index + created;
+        fiber->group_fresh = true;
+        fiber->priority = priority;
+
+        MARK_RUNNABLE(fiber);
+
+        batch[created] = fiber;
+    }
+
+    if (created < count) {
+        for (unsigned int i = 0; i < created; i++) {
+            FrameDelRec(batch[i]->frame);
+
+            batch[i]->frame = nullptr;
+            batch[i]->group_fresh = false;
+
+            FreeFiber(batch[i]);
+        }
+
+        memory::Free(batch);
+
+        return false;
+    }
+
+    GLOBAL_QUEUE(priority).Enqueue(batch, count);
+
+    memory::Free(batch);
+
+    OSTWakeRun();
+
+    return true;
+}
+
+String *argon::vm::SchedStatsDump() {
+    StringBuilder builder;
+    String *ret;
+
+    if (SchedStatsWrite(builder) && (ret = builder.BuildString()) != nullptr)
+        return ret;
+
+    auto *err = builder.GetError();
+
+    Panic((ArObject *) err);
+
+    Release(err);
+
+    return nullptr;
+}
+
 Fiber *argon::vm::GetFiber() {
     ON_ARGON_CONTEXT return ost_local->fiber;
 
@@ -1034,6 +1671,12 @@ Fiber *argon::vm::GetFiber() {
     return nullptr;
 }
 
+FiberPriority argon::vm::GetFiberPriority() {
+    auto *fiber = GetFiber();
+
+    return fiber != nullptr ? fiber->priority : FiberPriority::NORMAL;
+}
+
 FiberStatus argon::vm::GetFiberStatus() {
     ON_ARGON_CONTEXT return ost_local->fiber_status;
 
@@ -1052,13 +1695,94 @@ Frame *argon::vm::GetFrame() {
 
 void argon::vm::Cleanup() {
     if (ost_total == 0) {
+        for (unsigned int i = 0; i < ost_slot_count; i++)
+            FreeOSThread(ost_slots[i]);
+
+        memory::Free(ost_slots);
+
         for (unsigned int i = 0; i < vc_total; i++)
-            (vcores + i)->queue.~FiberQueue();
+            (vcores + i)->queue.~VCoreQueue();
 
         memory::MemoryFinalize();
     }
 }
 
+void argon::vm::EnterBlocking() {
+    auto *ost = ost_local;
+
+    if (ost == nullptr || ost->current == nullptr || ost->blocking)
+        return;
+
+    bool has_work = !ost->current->queue.IsEmpty();
+
+    ost->blocking = true;
+
+    SCHEDSTAT_INC(ost->stats, blocking);
+
+    VCoreRelease(ost);
+
+    // Hand the VCore over only if there is something to run, otherwise it stays idle
+    // and LeaveBlocking will probably find it still available
+    if (has_work || !GlobalIsEmpty())
+        OSTWakeRun();
+}
+
+void argon::vm::LeaveBlocking() {
+    auto *ost = ost_local;
+
+    if (ost == nullptr || !ost->blocking)
+        return;
+
+    // Don't lose the error of the blocking call
+    auto saved_errno = errno;
+
+#ifdef _ARGON_PLATFORM_WINDOWS
+    auto saved_error = ::GetLastError();
+#endif
+
+    ost->blocking = false;
+
+    // Fast path: the VCore released by EnterBlocking is usually still idle and, having no pending work,
+    // it was not linked in vcores_active, so it can be taken back without vc_lock
+    bool claimed = ClaimVCore(ost->old);
+
+    if (claimed && !ost->old->listed)
+        BindVCore(ost, ost->old);
+    else {
+        std::unique_lock lock(vc_lock);
+
+        if (claimed)
+            BindVCore(ost, ost->old);
+        else if (!AcquireVCore(ost)) {
+            // Every VCore is busy. The native caller cannot be suspended and the fiber must not run
+            // without a VCore, wait until a thread hands one over (see VCoreRelease)
+            ost->vc_next = nullptr;
+
+            auto **tail = &vc_waiters;
+            while (*tail != nullptr)
+                tail = &(*tail)->vc_next;
+
+            *tail = ost;
+            vc_waiters_count++;
+
+            while (ost->current == nullptr) {
+                lock.unlock();
+                ost->parker.Park();
+                lock.lock();
+            }
+        }
+    }
+
+    if (ost->current->cpu != ost->cpu)
+        OSTPin(ost);
+
+#ifdef _ARGON_PLATFORM_WINDOWS
+    ::SetLastError(saved_error);
+#endif
+
+    errno = saved_errno;
+}
+
 void argon::vm::DiscardLastPanic() {
     ON_ARGON_CONTEXT {
         PanicCleanup(&ost_local->fiber->panic);
@@ -1096,6 +1820,13 @@ void argon::vm::Panic(datatype::ArObject *panic) {
         PanicOOM(nullptr, &panic_global, panic);
 }
 
+void argon::vm::SetFiberPriority(FiberPriority priority) {
+    auto *fiber = GetFiber();
+
+    if (fiber != nullptr)
+        fiber->priority = priority;
+}
+
 void argon::vm::SetFiberStatus(FiberStatus status) {
     ON_ARGON_CONTEXT {
         ost_local->fiber->status = status;
@@ -1116,7 +1847,9 @@ void argon::vm::Spawn(argon::vm::Fiber *fiber) {
         return;
     }
 
-    fiber_global.Enqueue(fiber);
+    MARK_RUNNABLE(fiber);
+
+    GlobalEnqueue(fiber);
 
     OSTWakeRun();
 }
@@ -1131,6 +1864,7 @@ void argon::vm::Yield() {
 
     VCoreRelease(ost_local);
 
-    if (has_work)
+    // A thread that went to sleep while this VCore was still wired may have left work in the global queue
+    if (has_work || !GlobalIsEmpty())
         OSTWakeRun();
 }
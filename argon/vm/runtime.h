@@ -10,6 +10,7 @@
 #include <argon/vm/datatype/function.h>
 #include <argon/vm/datatype/namespace.h>
 #include <argon/vm/datatype/result.h>
+#include <argon/vm/datatype/taskgroup.h>
 
 #include <argon/vm/config.h>
 #include <argon/vm/context.h>
@@ -19,6 +20,7 @@
 namespace argon::vm {
     constexpr const unsigned int kOSThreadMax = 10000;
     constexpr const unsigned short kScheduleTickBeforeCheck = 32;
+    constexpr const unsigned short kScheduleTickBeforeAging = 16;
     constexpr const unsigned short kVCoreDefault = 4;
     constexpr const unsigned short kVCoreQueueLengthMax = 256;
 
@@ -65,6 +67,17 @@ namespace argon::vm {
 
     argon::vm::datatype::String *GetExecutablePath();
 
+    /**
+     * @brief Dump the scheduler statistics as JSON.
+     *
+     * Contains the depth of the global queues (total and per priority class), the counters of each VCore
+     * (run queue depth, dequeues by source, failed steals, overflows, runnable-to-running latency histogram)
+     * and of each OSThread (parks, unparks, spinning time). Counters are always zero if the VM was compiled without ARGON_FF_SCHEDSTATS.
+     *
+     * @return A pointer to an Argon string object, otherwise nullptr.
+     */
+    argon::vm::datatype::String *SchedStatsDump();
+
     bool CheckLastPanic(const char *id);
 
     bool Initialize(const Config *config);
@@ -75,7 +88,48 @@ namespace argon::vm {
 
     bool Shutdown();
 
-    bool Spawn(datatype::Function *func, datatype::ArObject **argv, datatype::ArSize argc, OpCodeCallMode mode);
+    /**
+     * @brief Run a function in a new fiber.
+     *
+     * @param func Function to call.
+     * @param argv Arguments.
+     * @param argc Number of arguments.
+     * @param mode Call mode.
+     * @param chunk_size Size of the first stack segment allocated when the inline stack of the fiber
+     * is exhausted (0 = kFiberChunkSize). Fibers that are known to recurse deeply should use a bigger value.
+     * @param priority Scheduling class of the new fiber.
+     * @return True on success, false otherwise.
+     */
+    bool Spawn(datatype::Function *func, datatype::ArObject **argv, datatype::ArSize argc, OpCodeCallMode mode,
+               unsigned int chunk_size, FiberPriority priority);
+
+    /**
+     * @brief Get the scheduling class of the current fiber.
+     *
+     * @return Scheduling class (NORMAL outside a fiber).
+     */
+    FiberPriority GetFiberPriority();
+
+    inline bool Spawn(datatype::Function *func, datatype::ArObject **argv, datatype::ArSize argc,
+                      OpCodeCallMode mode) {
+        return Spawn(func, argv, argc, mode, 0, GetFiberPriority());
+    }
+
+    /**
+     * @brief Run a batch of calls in new fibers that belong to a task group.
+     *
+     * All fibers are created first and then made runnable with a single enqueue operation on the global queue
+     * of the scheduling class of the current fiber.
+     * When a fiber completes its result is delivered to the group (see TaskGroupDone), fibers that
+     * have not started yet when the group is cancelled are discarded.
+     *
+     * @param group TaskGroup object.
+     * @param calls Array of tuples (func, args...).
+     * @param count Number of calls.
+     * @param index Index of the result of the first call in the group.
+     * @return True on success, false otherwise (no fiber was started).
+     */
+    bool SpawnGroup(datatype::TaskGroup *group, datatype::Tuple **calls, unsigned int count, unsigned int index);
 
     Fiber *GetFiber();
 
@@ -90,10 +144,36 @@ namespace argon::vm {
 
     void Cleanup();
 
+    /**
+     * @brief Notify the scheduler that the current fiber is about to enter a blocking system call.
+     *
+     * The OSThread releases its VCore, if there is work waiting to run another OSThread (idle or new)
+     * takes over the VCore while the call is in progress. Every call MUST be paired with LeaveBlocking.
+     * Nested calls are ignored, outside an OSThread this function does nothing.
+     */
+    void EnterBlocking();
+
+    /**
+     * @brief Reacquire a VCore after a blocking system call (see EnterBlocking).
+     *
+     * If all VCores are busy, the fiber is preempted at the next preemption point and waits for a VCore
+     * in the run queue. errno (and the last error on Windows) is preserved.
+     */
+    void LeaveBlocking();
+
     void DiscardLastPanic();
 
     void Panic(datatype::ArObject *panic);
 
+    /**
+     * @brief Set the scheduling class of the current fiber.
+     *
+     * The new class applies from the next time the fiber is enqueued (e.g. after a preemption).
+     *
+     * @param priority Scheduling class.
+     */
+    void SetFiberPriority(FiberPriority priority);
+
     void SetFiberStatus(FiberStatus status);
 
     void Spawn(Fiber *fiber);
@@ -0,0 +1,116 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#include <cstdarg>
+#include <cstdio>
+
+#include <argon/vm/schedstats.h>
+
+using namespace argon::vm::datatype;
+using namespace argon::vm::schedstats;
+
+constexpr ArSize kSchedStatsWriteOveralloc = 512;
+
+void argon::vm::schedstats::Accumulate(VCoreStats *dst, const VCoreStats *src) {
+#define SUM(field) dst->field.fetch_add(src->field.load(std::memory_order_relaxed), std::memory_order_relaxed)
+
+    SUM(executed);
+    SUM(local);
+    SUM(global);
+    SUM(stolen);
+    SUM(failed_steals);
+    SUM(overflows);
+
+    for (unsigned short i = 0; i < kLatencyBuckets; i++)
+        SUM(latency[i]);
+
+#undef SUM
+}
+
+void argon::vm::schedstats::Accumulate(OSThreadStats *dst, const OSThreadStats *src) {
+#define SUM(field) dst->field.fetch_add(src->field.load(std::memory_order_relaxed), std::memory_order_relaxed)
+
+    SUM(parks);
+    SUM(unparks);
+    SUM(spinning_ns);
+    SUM(blocking);
+    SUM(fiber_hits);
+    SUM(fiber_refills);
+    SUM(fiber_misses);
+    SUM(fiber_spills);
+
+#undef SUM
+}
+
+void argon::vm::schedstats::RecordLatency(VCoreStats *stats, unsigned long long latency_ns) {
+    auto us = latency_ns / 1000;
+    unsigned short bucket = 0;
+
+    while (us > 0 && bucket < kLatencyBuckets - 1) {
+        us >>= 1;
+        bucket++;
+    }
+
+    SCHEDSTAT_INC(*stats, latency[bucket]);
+}
+
+bool argon::vm::schedstats::WriteVCoreStats(StringBuilder &builder, const VCoreStats *stats) {
+#define LOAD(field) stats->field.load(std::memory_order_relaxed)
+
+    if (!Write(builder, "\"executed\": %llu, \"local\": %llu, ", LOAD(executed), LOAD(local)))
+        return false;
+
+    if (!Write(builder, "\"global\": %llu, \"stolen\": %llu, ", LOAD(global), LOAD(stolen)))
+        return false;
+
+    if (!Write(builder, "\"failed_steals\": %llu, \"overflows\": %llu, ", LOAD(failed_steals), LOAD(overflows)))
+        return false;
+
+    if (!Write(builder, "\"latency_us\": ["))
+        return false;
+
+    for (unsigned short i = 0; i < kLatencyBuckets; i++) {
+        if (!Write(builder, "%s%llu", i > 0 ? ", " : "", LOAD(latency[i])))
+            return false;
+    }
+
+    return builder.Write((const unsigned char *) "]", 1, kSchedStatsWriteOveralloc);
+
+#undef LOAD
+}
+
+bool argon::vm::schedstats::WriteOSThreadStats(StringBuilder &builder, const OSThreadStats *stats) {
+#define LOAD(field) stats->field.load(std::memory_order_relaxed)
+
+    if (!Write(builder, "\"parks\": %llu, \"unparks\": %llu, \"spinning_us\": %llu, ",
+               LOAD(parks), LOAD(unparks), LOAD(spinning_ns) / 1000))
+        return false;
+
+    if (!Write(builder, "\"blocking\": %llu, ", LOAD(blocking)))
+        return false;
+
+    if (!Write(builder, "\"fiber_hits\": %llu, \"fiber_refills\": %llu, ", LOAD(fiber_hits), LOAD(fiber_refills)))
+        return false;
+
+    return Write(builder, "\"fiber_misses\": %llu, \"fiber_spills\": %llu", LOAD(fiber_misses), LOAD(fiber_spills));
+
+#undef LOAD
+}
+
+bool argon::vm::schedstats::Write(StringBuilder &builder, const char *format, ...) {
+    char buffer[128];
+    va_list args;
+
+    va_start(args, format);
+    auto length = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+
+    if (length < 0)
+        return false;
+
+    if (length >= (int) sizeof(buffer))
+        length = sizeof(buffer) - 1;
+
+    return builder.Write((const unsigned char *) buffer, length, kSchedStatsWriteOveralloc);
+}
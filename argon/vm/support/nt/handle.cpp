@@ -48,7 +48,7 @@ ARGON_METHOD(oshandle_dup, dup,
              "  - options: Optional actions.\n"
              "- Returns: Handle object.\n"
              "- Remarks: See Windows DuplicateHandle function for more details.\n",
-             nullptr, false, true) {
+             nullptr, false, kFunctionKWArgsView) {
     auto *self = (OSHandle *) _self;
     OSHandle *rHandle;
 
@@ -111,7 +111,7 @@ ARGON_METHOD(oshandle_waitobject, waitobject,
              "- KWParameters:\n"
              "  - timeout: The time-out interval, in milliseconds.\n"
              "- Remarks: See Windows WaitForSingleObject function for more details.\n",
-             nullptr, false, true) {
+             nullptr, false, kFunctionKWArgsView) {
     auto *self = (OSHandle *) _self;
     IntegerUnderlying millisecond = INFINITE;
 
@@ -0,0 +1,53 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#include <argon/vm/sync/parker.h>
+
+#include <argon/util/macros.h>
+
+#if defined(_ARGON_PLATFORM_WINDOWS)
+#include <Windows.h>
+
+#define OS_WAIT(ptr, value)                                         \
+    do {                                                            \
+        auto stored = value;                                        \
+        WaitOnAddress(ptr, &stored, sizeof(ParkerWord), INFINITE);  \
+    } while(0)
+
+#define OS_WAKE(ptr)            WakeByAddressSingle(ptr)
+
+#elif defined(_ARGON_PLATFORM_DARWIN)
+extern "C" int __ulock_wait(unsigned int operation, void *addr, unsigned long long value, unsigned int timeout);
+extern "C" int __ulock_wake(unsigned int operation, void *addr, unsigned long long wake_value);
+
+#define UL_COMPARE_AND_WAIT 1
+
+#define OS_WAIT(ptr, value)     __ulock_wait(UL_COMPARE_AND_WAIT, ptr, value, 0)
+#define OS_WAKE(ptr)            __ulock_wake(UL_COMPARE_AND_WAIT, ptr, 0)
+
+#elif defined(_ARGON_PLATFORM_LINUX)
+
+#include <linux/futex.h>
+#include <syscall.h>
+#include <unistd.h>
+
+#define OS_WAIT(ptr, value)     syscall(SYS_futex, ptr, FUTEX_WAIT_PRIVATE, value, nullptr, nullptr, 0)
+#define OS_WAKE(ptr)            syscall(SYS_futex, ptr, FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0)
+
+#else
+#error "unsupported platform"
+#endif
+
+using namespace argon::vm::sync;
+
+void Parker::Park() {
+    // Spurious wakeups are possible, sleep again until a permit is actually available
+    while (this->permit_.exchange(0, std::memory_order_acquire) == 0)
+        OS_WAIT(&this->permit_, 0);
+}
+
+void Parker::Unpark() {
+    if (this->permit_.exchange(1, std::memory_order_release) == 0)
+        OS_WAKE(&this->permit_);
+}
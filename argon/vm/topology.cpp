@@ -0,0 +1,149 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#include <argon/util/macros.h>
+
+#if defined(_ARGON_PLATFORM_LINUX)
+
+#include <dirent.h>
+#include <pthread.h>
+#include <sched.h>
+
+#elif defined(_ARGON_PLATFORM_WINDOWS)
+
+#include <windows.h>
+
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#include <argon/vm/topology.h>
+
+using namespace argon::vm;
+
+CPUInfo argon::vm::TopologyAssign(unsigned int index, const CPUInfo *cpus, unsigned int count) {
+    if (count == 0)
+        return {-1, 0};
+
+    return cpus[index % count];
+}
+
+unsigned int argon::vm::TopologyCountNodes(const CPUInfo *cpus, unsigned int count, unsigned int vcores) {
+    unsigned int nodes = 1;
+
+    if (vcores < count)
+        count = vcores;
+
+    // The CPUs are grouped by node, every change of node is a new one
+    for (unsigned int i = 1; i < count; i++) {
+        if (cpus[i].node != cpus[i - 1].node)
+            nodes++;
+    }
+
+    return nodes;
+}
+
+#if defined(_ARGON_PLATFORM_LINUX)
+
+int CPUNode(int cpu) {
+    char path[64];
+    DIR *dir;
+
+    snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d", cpu);
+
+    if ((dir = opendir(path)) == nullptr)
+        return 0;
+
+    const struct dirent *entry;
+    int node = 0;
+
+    // The cpu directory contains a nodeN link to the NUMA node that owns it
+    while ((entry = readdir(dir)) != nullptr) {
+        char *end;
+
+        if (strncmp(entry->d_name, "node", 4) != 0)
+            continue;
+
+        auto value = strtol(entry->d_name + 4, &end, 10);
+        if (end != entry->d_name + 4 && *end == '\0') {
+            node = (int) value;
+            break;
+        }
+    }
+
+    closedir(dir);
+
+    return node;
+}
+
+unsigned int argon::vm::TopologyGetCPUs(CPUInfo *cpus, unsigned int max_cpus) {
+    cpu_set_t set;
+    unsigned int count = 0;
+
+    CPU_ZERO(&set);
+
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &set) != 0)
+        return 0;
+
+    for (int i = 0; i < CPU_SETSIZE && count < max_cpus; i++) {
+        if (CPU_ISSET(i, &set))
+            cpus[count++] = {i, CPUNode(i)};
+    }
+
+    std::stable_sort(cpus, cpus + count, [](const CPUInfo &a, const CPUInfo &b) {
+        return a.node < b.node;
+    });
+
+    return count;
+}
+
+bool argon::vm::TopologyPinThread(int cpu) {
+    cpu_set_t set;
+
+    if (cpu < 0 || cpu >= CPU_SETSIZE)
+        return false;
+
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &set) == 0;
+}
+
+#else
+
+unsigned int argon::vm::TopologyGetCPUs(CPUInfo *cpus, unsigned int max_cpus) {
+    unsigned int count = std::thread::hardware_concurrency();
+
+    if (count > max_cpus)
+        count = max_cpus;
+
+    for (unsigned int i = 0; i < count; i++)
+        cpus[i] = {(int) i, 0};
+
+    return count;
+}
+
+#if defined(_ARGON_PLATFORM_WINDOWS)
+
+bool argon::vm::TopologyPinThread(int cpu) {
+    if (cpu < 0 || cpu >= (int) (sizeof(DWORD_PTR) * 8))
+        return false;
+
+    return SetThreadAffinityMask(GetCurrentThread(), ((DWORD_PTR) 1) << cpu) != 0;
+}
+
+#else
+
+bool argon::vm::TopologyPinThread(int cpu) {
+    // Darwin does not allow a thread to be bound to a specific CPU
+    return false;
+}
+
+#endif
+
+#endif
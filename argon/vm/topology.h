@@ -0,0 +1,97 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#ifndef ARGON_VM_TOPOLOGY_H_
+#define ARGON_VM_TOPOLOGY_H_
+
+namespace argon::vm {
+    constexpr const unsigned int kTopologyMaxCPUs = 1024;
+
+    struct CPUInfo {
+        /// Logical CPU index (as seen by the OS scheduler).
+        int cpu;
+
+        /// NUMA node that owns the CPU.
+        int node;
+    };
+
+    /**
+     * @brief Get the CPU assigned to a VCore.
+     *
+     * The CPUs are assigned in order, so contiguous VCores share the same NUMA node.
+     * If there are more VCores than CPUs, the assignment starts again from the first CPU.
+     *
+     * @param index VCore index.
+     * @param cpus CPUs returned by TopologyGetCPUs.
+     * @param count Number of entries in cpus (0: no affinity, the VCore gets cpu -1 on node 0).
+     * @return CPU and NUMA node of the VCore.
+     */
+    CPUInfo TopologyAssign(unsigned int index, const CPUInfo *cpus, unsigned int count);
+
+    /**
+     * @brief Get the CPUs the process is allowed to run on, grouped by NUMA node.
+     *
+     * If the topology cannot be detected, the CPUs are reported as belonging to node 0.
+     *
+     * @param cpus Array that receives the CPUs (ordered by node, then by cpu index).
+     * @param max_cpus Max number of entries in the array.
+     * @return Number of CPUs written to the array (0 if no information is available).
+     */
+    unsigned int TopologyGetCPUs(CPUInfo *cpus, unsigned int max_cpus);
+
+    /**
+     * @brief Pin the calling thread to a CPU.
+     *
+     * @param cpu Logical CPU index.
+     * @return true on success, false otherwise (or if the platform does not support thread affinity).
+     */
+    bool TopologyPinThread(int cpu);
+
+    /**
+     * @brief Count the NUMA nodes spanned by the VCores.
+     *
+     * @param cpus CPUs returned by TopologyGetCPUs.
+     * @param count Number of entries in cpus.
+     * @param vcores Number of VCores (see TopologyAssign).
+     * @return Number of distinct nodes (at least 1).
+     */
+    unsigned int TopologyCountNodes(const CPUInfo *cpus, unsigned int count, unsigned int vcores);
+
+    /**
+     * @brief Visit the VCores a thief can steal work from.
+     *
+     * Each VCore other than the thief is visited once per pass, starting from a given index.
+     * The first pass visits the victims on the NUMA node of the thief, the second one (only if the VCores span
+     * more than one node) all the others.
+     *
+     * @param count Number of VCores.
+     * @param nodes Number of NUMA nodes spanned by the VCores (see TopologyCountNodes).
+     * @param thief Index of the VCore that is looking for work.
+     * @param start Index of the first VCore to visit.
+     * @param node_of Returns the NUMA node of a VCore, given its index.
+     * @param steal Called with the index of each victim, the visit ends when it returns true.
+     * @return true if steal returned true, false otherwise.
+     */
+    template<typename NodeOf, typename Steal>
+    bool TopologyVisitVictims(unsigned int count, unsigned int nodes, unsigned int thief, unsigned int start,
+                              NodeOf node_of, Steal steal) {
+        auto thief_node = node_of(thief);
+
+        for (unsigned int pass = 0; pass < nodes && pass < 2; pass++) {
+            for (unsigned int i = 0; i < count; i++) {
+                auto victim = (start + i) % count;
+
+                if (victim == thief || (node_of(victim) == thief_node) != (pass == 0))
+                    continue;
+
+                if (steal(victim))
+                    return true;
+            }
+        }
+
+        return false;
+    }
+} // namespace argon::vm
+
+#endif // !ARGON_VM_TOPOLOGY_H_
@@ -0,0 +1,12 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#ifndef ARGON_VM_ARGON_H_
+#define ARGON_VM_ARGON_H_
+
+namespace argon::vm {
+    int ArgonMain(int argc, char **argv);
+} // namespace argon::vm
+
+#endif // !ARGON_VM_ARGON_H_
@@ -0,0 +1,50 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#ifndef ARGON_VM_CONFIG_H_
+#define ARGON_VM_CONFIG_H_
+
+#define ARGON_EVAR_PATH       "ARGON_PATH"
+#define ARGON_EVAR_UNBUFFERED "ARGON_UNBUFFERED"
+#define ARGON_EVAR_STARTUP    "ARGON_STARTUP"
+#define ARGON_EVAR_MAXVC      "ARGON_MAXVC"
+#define ARGON_EVAR_AFFINITY   "ARGON_AFFINITY"
+#define ARGON_EVAR_SLICE      "ARGON_SLICE"
+#define ARGON_EVAR_SCHEDSTATS "ARGON_SCHEDSTATS"
+#define ARGON_EVAR_HUGEPAGES  "ARGON_HUGEPAGES"
+#define ARGON_EVAR_DECAY      "ARGON_DECAY"
+#define ARGON_EVAR_JIT        "ARGON_JIT"
+
+namespace argon::vm {
+    struct Config {
+        char **argv;
+        int argc;
+
+        bool affinity;
+        bool interactive;
+        bool nogc;
+        bool quiet;
+        bool stack_trace;
+        bool unbuffered;
+
+        int cmd;
+        int file;
+        int max_vc;
+        int max_ost;
+        int fiber_ss;
+        int fiber_pool;
+        int optim_lvl;
+        int time_slice;
+        int schedstats;
+        int huge_pages;
+        int arena_decay;
+        int jit;
+    };
+
+    extern const Config *kConfigDefault;
+
+    bool ConfigInit(Config *config, int argc, char **argv);
+} // namespace argon::vm
+
+#endif // !ARGON_VM_CONFIG_H_
@@ -0,0 +1,322 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#ifndef ARGON_VM_DATATYPE_AROBJECT_H_
+#define ARGON_VM_DATATYPE_AROBJECT_H_
+
+#include <cstddef>
+
+#include <argon/util/macros.h>
+
+#include <argon/vm/memory/gc.h>
+#include <argon/vm/memory/heapprof.h>
+
+#include <argon/vm/datatype/objectdef.h>
+
+namespace argon::vm::datatype {
+    _ARGONAPI extern const TypeInfo *type_type_;
+
+    /// Number of receiver types that can be tracked by a single attribute cache.
+    constexpr unsigned short kAttributeCacheWays = 4;
+
+    enum class AttributeCacheKind : unsigned char {
+        EMPTY,
+        FIELD,
+        VALUE,
+        WRAPPER
+    };
+
+    struct AttributeCacheEntry {
+        /// Version tag of the receiver type (see TypeGetVersionTag).
+        std::atomic<ArSize> tag;
+
+        /// Borrowed reference to the resolved attribute (VALUE) or to its NativeWrapper (WRAPPER).
+        std::atomic<ArObject *> value;
+
+        /// AttributeCacheKind in the low bits, is_method flag in the high bit.
+        std::atomic<unsigned char> info;
+    };
+
+    /**
+     * @brief Inline cache associated with a single LDATTR/LDMETH instruction.
+     *
+     * Entries are keyed on the version tag of the receiver type, the cached values are borrowed from the type
+     * namespace (or from one of its MRO ancestors) that are only populated while the type is being defined.
+     */
+    struct AttributeCache {
+        /// Attribute name (borrowed from Code::statics).
+        ArObject *key;
+
+        /// Index of the attribute name in Code::statics.
+        unsigned int index;
+
+        AttributeCacheEntry entries[kAttributeCacheWays];
+    };
+
+    ArObject *AttributeLoad(const ArObject *object, ArObject *key, bool static_attr);
+
+    /**
+     * @brief Like AttributeLoad, but uses (and updates) the inline cache associated with an LDATTR instruction.
+     *
+     * @param object Pointer to the instance.
+     * @param cache Pointer to the inline cache.
+     * @return A pointer to the attribute on success, otherwise nullptr (panic state will be set).
+     */
+    ArObject *AttributeLoadCached(const ArObject *object, AttributeCache *cache);
+
+    ArObject *AttributeLoadMethod(const ArObject *object, ArObject *key, bool *is_method);
+
+    /**
+     * @brief Like AttributeLoadMethod, but uses (and updates) the inline cache associated with an LDMETH instruction.
+     *
+     * @param object Pointer to the instance.
+     * @param cache Pointer to the inline cache.
+     * @param is_method Pointer to a bool variable that receives true if the attribute is a method of object.
+     * @return A pointer to the attribute on success, otherwise nullptr (panic state will be set).
+     */
+    ArObject *AttributeLoadMethodCached(const ArObject *object, AttributeCache *cache, bool *is_method);
+
+    ArObject *AttributeLoadMethod(const ArObject *object, const char *key);
+
+    ArObject *ComputeMRO(TypeInfo *type, TypeInfo **bases, unsigned int length);
+
+    ArObject *Compare(const ArObject *self, const ArObject *other, CompareMode mode);
+
+    ArObject *ExecBinaryOp(ArObject *left, ArObject *right, int offset);
+
+    ArObject *ExecBinaryOpOriented(ArObject *left, ArObject *right, int offset);
+
+    ArObject *IteratorGet(ArObject *object, bool reversed);
+
+    ArObject *IteratorNext(ArObject *iterator);
+
+    ArObject *Repr(ArObject *object);
+
+    ArObject *Str(ArObject *object);
+
+    ArObject *TraitNew(const char *name, const char *qname, const char *doc,
+                       ArObject *ns, TypeInfo **bases, unsigned int length);
+
+    ArObject *TypeNew(const TypeInfo *type, const char *name, const char *qname, const char *doc,
+                      ArObject *ns, TypeInfo **bases, unsigned int length);
+
+    bool AttributeSet(ArObject *object, ArObject *key, ArObject *value, bool static_attr);
+
+    bool BufferGet(ArObject *object, ArBuffer *buffer, BufferFlags flags);
+
+    bool BufferSimpleFill(const ArObject *object, ArBuffer *buffer, BufferFlags flags, unsigned char *raw,
+                          ArSize item_size, ArSize nelem, bool writable);
+
+    bool CheckOverrideMethod(TypeInfo *type, ArObject *method);
+
+    bool Equal(const ArObject *self, const ArObject *other);
+
+    inline bool EqualStrict(const ArObject *self, const ArObject *other) {
+        if (AR_SAME_TYPE(self, other))
+            return Equal(self, other);
+
+        return false;
+    }
+
+    bool Hash(ArObject *object, ArSize *out_hash);
+
+    inline bool IsBufferable(const ArObject *object) {
+        return AR_GET_TYPE(object)->buffer != nullptr && AR_GET_TYPE(object)->buffer->get_buffer != nullptr;
+    }
+
+    bool IsNull(const ArObject *object);
+
+    bool IsTrue(const ArObject *object);
+
+    /**
+     * @brief Returns the version tag of a type, assigning a new one if necessary.
+     *
+     * Tags are never reused, so an attribute cache entry keyed on a tag remains valid as long as the type
+     * is not modified (see TypeModified).
+     *
+     * @param type Pointer to the type.
+     * @return Version tag, or 0 if the type cannot be cached (e.g. not yet initialized).
+     */
+    ArSize TypeGetVersionTag(const TypeInfo *type);
+
+    bool TypeInit(TypeInfo *type, ArObject *auxiliary, TypeInfo **bases, unsigned int length);
+
+    inline bool TypeInit(TypeInfo *type, ArObject *auxiliary) {
+        return TypeInit(type, auxiliary, nullptr, 0);
+    }
+
+    bool TraitIsImplemented(const TypeInfo *obj_type, const TypeInfo *type);
+
+    bool TypeOF(const ArObject *object, const TypeInfo *type);
+
+    /**
+     * @brief Invalidates all attribute cache entries that refer to the type.
+     *
+     * Types are immutable once their definition is complete (static attributes are constants and cannot be
+     * reassigned), so this is only needed while a type is being defined (TypeInit, TSTORE). At that point the type
+     * cannot be a base of any other type yet, hence subtypes are never invalidated.
+     *
+     * @param type Pointer to the modified type.
+     */
+    void TypeModified(TypeInfo *type);
+
+    int MonitorAcquire(ArObject *object);
+
+    int RecursionTrack(ArObject *object);
+
+    template<typename T>
+    T *IncRef(T *t) {
+        if (t != nullptr && !AR_GET_RC(t).IncStrong())
+            return nullptr;
+
+        return t;
+    }
+
+    template<typename T>
+    T *MakeObject(const TypeInfo *type) {
+        auto *ret = (ArObject *) argon::vm::memory::Alloc(type->size);
+        if (ret == nullptr)
+            return nullptr;
+
+        AR_UNSAFE_GET_RC(ret) = (ArSize) memory::RCType::INLINE;
+        AR_GET_TYPE(ret) = type;
+        AR_UNSAFE_GET_MON(ret) = nullptr;
+
+        memory::HeapProfTrackObject(ret, ret);
+
+        return (T *) ret;
+    }
+
+    template<typename T>
+    T *MakeObject(TypeInfo *type) {
+        auto *ret = MakeObject<T>((const TypeInfo *) type);
+        if (ret != nullptr)
+            IncRef(type);
+
+        return ret;
+    }
+
+    template<typename T>
+    T *MakeGCObject(const TypeInfo *type) {
+        return (T *) memory::GCNew(type, false);
+    }
+
+    template<typename T>
+    T *MakeGCObject(TypeInfo *type) {
+        auto *ret = (T *) memory::GCNew(type, false);
+        if (ret != nullptr)
+            IncRef(type);
+
+        return ret;
+    }
+
+    void BufferRelease(ArBuffer *buffer);
+
+    void MonitorDestroy(ArObject *object);
+
+    void MonitorRelease(ArObject *object);
+
+    void Release(ArObject *object);
+
+    template<typename T>
+    inline void Release(T **object) {
+        Release(*object);
+        *object = nullptr;
+    }
+
+    template<typename T>
+    inline void Release(T *t) {
+        Release((ArObject *) t);
+    }
+
+    inline void Replace(ArObject **variable, ArObject *value) {
+        Release(*variable);
+        *variable = value;
+    }
+
+    void RecursionUntrack(ArObject *object);
+
+    class ARC {
+        ArObject *object_ = nullptr;
+
+    public:
+        ARC() = default;
+
+        explicit ARC(ArObject *object) : object_(object) {}
+
+        ARC(ARC &other) = delete;
+
+        ~ARC() {
+            Release(this->object_);
+        }
+
+        template<typename T>
+        ARC &operator=(T *object) {
+            Release(this->object_);
+
+            this->object_ = (ArObject *) object;
+
+            return *this;
+        }
+
+        ARC &operator=(const ARC &other) {
+            if (this == &other)
+                return *this;
+
+            Release(this->object_);
+
+            this->object_ = IncRef(other.object_);
+
+            return *this;
+        }
+
+        ARC &operator=(ARC &&other) = delete;
+
+        ArObject *Get() {
+            return this->object_;
+        }
+
+        ArObject *Unwrap() {
+            auto tmp = this->object_;
+
+            this->object_ = nullptr;
+
+            return tmp;
+        }
+
+        explicit operator bool() const {
+            return this->object_ != nullptr;
+        }
+
+        void Discard() {
+            Release(this->object_);
+            this->object_ = nullptr;
+        }
+    };
+
+    class RefStore {
+        union {
+            ArObject *s_value;
+            memory::RefCount w_value;
+        };
+
+        bool weak_ = false;
+
+    public:
+        ~RefStore();
+
+        ArObject *Get();
+
+        [[nodiscard]] ArObject *GetRawReference() const;
+
+        void Store(ArObject *object, bool strong);
+
+        void Store(ArObject *object);
+
+        void Release();
+    };
+
+} // namespace argon::vm::datatype
+
+#endif // !ARGON_VM_DATATYPE_AROBJECT_H_
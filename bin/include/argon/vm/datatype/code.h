@@ -0,0 +1,279 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#ifndef ARGON_VM_DATATYPE_CODE_H_
+#define ARGON_VM_DATATYPE_CODE_H_
+
+#include <cstdint>
+
+#include <argon/vm/opcode.h>
+
+#include <argon/vm/datatype/arobject.h>
+#include <argon/vm/datatype/arstring.h>
+#include <argon/vm/datatype/list.h>
+#include <argon/vm/datatype/tuple.h>
+
+namespace argon::vm::jit {
+    struct JITCode;
+}
+
+namespace argon::vm::datatype {
+    /// Value replaced by a refill of a GlobalCache, a concurrent reader may still be using it.
+    struct GlobalCacheRetired {
+        GlobalCacheRetired *next;
+
+        ArObject *value;
+    };
+
+    /// Refills after which a GlobalCache stops following a symbol that keeps being rebound.
+    constexpr unsigned char kGlobalCacheMaxRefills = 8;
+
+    /**
+     * @brief Cache used by LDGBL, it is valid as long as both globals and builtins namespaces are unchanged.
+     */
+    struct GlobalCache {
+        /// Version of the globals namespace when the cache was filled (0 means empty).
+        std::atomic<std::uint64_t> globals_version;
+
+        /// Version of the builtins namespace when the cache was filled.
+        std::atomic<std::uint64_t> builtins_version;
+
+        /// Strong reference to a constant symbol.
+        std::atomic<ArObject *> value;
+
+        /// Previous values (strong references), they are released together with the Code object.
+        GlobalCacheRetired *retired;
+
+        /// Number of times the value was replaced.
+        unsigned char refills;
+    };
+
+    /// Type guard failures after which a quickened instruction is pinned to its generic form.
+    constexpr unsigned char kQuickenMaxMisses = 4;
+
+    constexpr unsigned char kJITCold = 0;
+    constexpr unsigned char kJITCompiling = 1;
+    constexpr unsigned char kJITCompiled = 2;
+    constexpr unsigned char kJITFailed = 3;
+
+    struct Code {
+        AROBJ_HEAD;
+
+        /// Code name.
+        String *name;
+
+        /// Code qualified name.
+        String *qname;
+
+        /// Code documentation.
+        String *doc;
+
+        /// Static resources.
+        Tuple *statics;
+
+        /// External variables (global scope).
+        Tuple *names;
+
+        /// Local variables names (function parameters)
+        Tuple *lnames;
+
+        /// Closure.
+        Tuple *enclosed;
+
+        /// Array that contains Argon assembly.
+        const unsigned char *instr;
+
+        /// Pointer to the end of the array that contains the Argon assembly.
+        const unsigned char *instr_end;
+
+        /// Array that contains mapping between code lines and opcodes.
+        const unsigned char *linfo;
+
+        /// Length of instr.
+        unsigned int instr_sz;
+
+        /// Length of linfo
+        unsigned int linfo_sz;
+
+        /// Maximum stack size required to run this code.
+        unsigned short stack_sz;
+
+        /// Maximum stack size reserved for local variables.
+        unsigned short locals_sz;
+
+        /// Maximum size required by sync stack.
+        unsigned short sstack_sz;
+
+        /// Hash value computed on buffer instr.
+        ArSize hash;
+
+        /// Inline caches used by LDATTR/LDMETH (one for each instruction, see SetBytecode).
+        AttributeCache *attr_cache;
+
+        /// Maps an instruction offset to its AttributeCache (index + 1, 0 means no cache).
+        unsigned short *attr_cache_map;
+
+        /// Length of attr_cache.
+        unsigned int attr_cache_sz;
+
+        /// Caches used by LDGBL (one for each entry in names).
+        GlobalCache *gbl_cache;
+
+        /// Type guard failures of quickened instructions (indexed by offset, allocated on the first failure).
+        std::atomic<std::atomic<unsigned char> *> qk_misses;
+
+        /// Machine code generated by the baseline JIT (see jit::Enter), valid once jit_state is kJITCompiled.
+        jit::JITCode *jit;
+
+        /// Calls and backward jumps counted by the JIT to decide when to compile this code.
+        unsigned int jit_hotness;
+
+        /// JIT compilation state (kJITCold, kJITCompiling, kJITCompiled or kJITFailed).
+        std::atomic<unsigned char> jit_state;
+
+        /**
+         * @brief Set bytecode to code object.
+         *
+         * If the attribute caches can be allocated, every LDATTR/LDMETH instruction gets its own AttributeCache.
+         * The bytecode is left untouched, caches are retrieved by instruction offset (see GetAttributeCache).
+         *
+         * @param co_instr Buffer containing the bytecode of the Argon VM (give buffer ownership to the Code object).
+         * @param co_instr_sz Length of instr buffer.
+         * @param co_stack_sz Length of evaluation stack.
+         * @param co_sstack_sz Length of sync stack.
+         * @return this
+         */
+        Code *SetBytecode(const unsigned char *co_instr, unsigned int co_instr_sz,
+                          unsigned int co_stack_sz, unsigned int co_sstack_sz) {
+            assert(this->instr == nullptr);
+            this->instr = co_instr;
+
+            assert(this->instr_end == nullptr);
+            this->instr_end = co_instr + co_instr_sz;
+
+            this->instr_sz = co_instr_sz;
+            this->sstack_sz = co_sstack_sz;
+            this->stack_sz = co_stack_sz;
+
+            this->InitAttributeCache();
+            this->InitGlobalCache();
+            this->InitHash();
+
+            return this;
+        }
+
+        /***
+         * @brief Set mapping between lines and opcodes.
+         * @param co_linfo Buffer containing lineno offsets
+         * @param size Length of lnotab buffer
+         * @return this
+         */
+        Code *SetTracingInfo(const unsigned char *co_linfo, unsigned int size) {
+            assert(this->linfo == nullptr);
+            this->linfo = co_linfo;
+            this->linfo_sz = size;
+
+            return this;
+        }
+
+        /**
+         * @brief Set information to code object.
+         *
+         * @param co_name Code name.
+         * @param co_qname Code qualified name.
+         * @param co_doc Code Documentation (Makes sense for struct, trait, function, module).
+         * @return this
+         */
+        Code *SetInfo(String *co_name, String *co_qname, String *co_doc) {
+            assert(this->name == nullptr);
+            this->name = IncRef(co_name);
+
+            assert(this->qname == nullptr);
+            this->qname = IncRef(co_qname);
+
+            assert(this->doc == nullptr);
+            this->doc = IncRef(co_doc);
+
+            return this;
+        }
+
+        /**
+         * @brief Returns the AttributeCache associated with an LDATTR/LDMETH instruction.
+         *
+         * @param ip Pointer to the instruction.
+         * @return Pointer to the cache, or nullptr if the instruction has no cache.
+         */
+        AttributeCache *GetAttributeCache(const unsigned char *ip) const {
+            unsigned short index;
+
+            if (this->attr_cache_map == nullptr || (index = this->attr_cache_map[ip - this->instr]) == 0)
+                return nullptr;
+
+            return this->attr_cache + (index - 1);
+        }
+
+        /**
+         * @brief Checks if the instruction can be replaced by its specialized form.
+         *
+         * @param ip Pointer to the instruction.
+         * @return False if the specialized form has been rejected too many times (see QuickenMiss).
+         */
+        bool CanQuicken(const unsigned char *ip) const {
+            const auto *misses = this->qk_misses.load(std::memory_order_acquire);
+
+            return misses == nullptr || misses[ip - this->instr].load(std::memory_order_relaxed) < kQuickenMaxMisses;
+        }
+
+        unsigned int GetLineMapping(ArSize offset) const;
+
+        void InitAttributeCache();
+
+        void InitGlobalCache();
+
+        void InitHash();
+
+        /**
+         * @brief Records a type guard failure of a quickened instruction.
+         *
+         * @param ip Pointer to the instruction.
+         */
+        void QuickenMiss(const unsigned char *ip);
+    };
+
+    _ARGONAPI extern const TypeInfo *type_code_;
+
+    /**
+     * @brief Create a new code object.
+     *
+     * @param statics List of static resources (Int, String, etc...).
+     * @param names Global names.
+     * @param lnames Local variables.
+     * @param enclosed Enclosed variable names (If present, this code is associate to function closure).
+     * @param locals_sz Space reserved for local variables on the stack.
+     * @return A pointer to an code object, otherwise nullptr.
+     */
+
+    Code *CodeNew(List *statics, List *names, List *lnames, List *enclosed, unsigned short locals_sz);
+
+    /**
+     * @brief Create a new code object to wrap native function.
+     *
+     * This function creates a code object containing a function call.
+     * It literally contains the following bytecode:
+     *
+     * CALL argc | mode
+     * RET
+     *
+     * The purpose of this code is to wrap a native function to be used in Argon "thread".
+     * If you are curious take a look at "FrameWrapFnNew"
+     *
+     * @param argc Number of call arguments.
+     * @param mode Call mode.
+     * @return A pointer to an code object, otherwise nullptr.
+     */
+    Code *CodeWrapFnCall(unsigned short argc, OpCodeCallMode mode);
+
+} // namespace argon::vm::datatype
+
+#endif // !ARGON_VM_DATATYPE_CODE_H_
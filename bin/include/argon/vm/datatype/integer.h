@@ -0,0 +1,123 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#ifndef ARGON_VM_DATATYPE_INTEGER_H_
+#define ARGON_VM_DATATYPE_INTEGER_H_
+
+#include <cfloat>
+
+#include <argon/vm/datatype/arobject.h>
+#include <argon/vm/datatype/decimal.h>
+
+#ifndef ARGON_VM_SMALLINT_MIN
+#define ARGON_VM_SMALLINT_MIN   (-256)
+#endif
+
+#ifndef ARGON_VM_SMALLINT_MAX
+#define ARGON_VM_SMALLINT_MAX   1024
+#endif
+
+namespace argon::vm::datatype {
+    using IntegerUnderlying = long long;
+    using UIntegerUnderlying = unsigned long long;
+
+    /// Integers in the range [kSmallIntMin, kSmallIntMax] are preallocated and shared (see IntNew/UIntNew).
+    constexpr IntegerUnderlying kSmallIntMin = ARGON_VM_SMALLINT_MIN;
+    constexpr IntegerUnderlying kSmallIntMax = ARGON_VM_SMALLINT_MAX;
+
+    static_assert(kSmallIntMin <= 0 && kSmallIntMax >= 0, "small integer cache must contain zero");
+
+    struct Integer {
+        AROBJ_HEAD;
+
+        union {
+            IntegerUnderlying sint;
+            UIntegerUnderlying uint;
+        };
+    };
+    _ARGONAPI extern const TypeInfo *type_int_;
+    _ARGONAPI extern const TypeInfo *type_uint_;
+
+    inline bool IsIntType(const ArObject *object) {
+        return AR_TYPEOF(object, type_int_) || AR_TYPEOF(object, type_uint_);
+    }
+
+    template<typename T>
+    int IntegerCountBits(T number) {
+        int count = 0;
+
+        if (number < 0)
+            number *= -1;
+
+        while (number) {
+            count++;
+            number >>= 1u;
+        }
+
+        return count;
+    }
+
+    template<typename T>
+    int IntegerCountDigits(T number, int base) {
+        int count = 0;
+
+        if (number == 0)
+            return 1;
+
+        while (number) {
+            count++;
+            number /= base;
+        }
+
+        return count;
+    }
+
+    template<typename T>
+    DecimalUnderlying Integer2ScaledDouble(T num, int bits, int *exp) {
+        int sign = 1;
+
+        if (num < 0) {
+            sign = -1;
+            num = -num;
+        }
+
+        auto exceeded = bits;
+        while (exceeded > LDBL_MANT_DIG) {
+            num >>= 1;
+            exceeded--;
+        }
+
+        *exp = bits - exceeded;
+
+        assert(num > 0.0);
+        return num * sign;
+    }
+
+    /**
+     * @brief Create a new Int object.
+     *
+     * Small values are taken from a preallocated cache: the returned object may be shared,
+     * so it MUST NOT be modified after creation.
+     *
+     * @param number Integer value.
+     * @return A pointer to an Int object, otherwise nullptr.
+     */
+    Integer *IntNew(IntegerUnderlying number);
+
+    Integer *IntNew(const char *string, int base);
+
+    /**
+     * @brief Create a new UInt object.
+     *
+     * Like IntNew, small values are shared and MUST NOT be modified after creation.
+     *
+     * @param number Unsigned integer value.
+     * @return A pointer to an UInt object, otherwise nullptr.
+     */
+    Integer *UIntNew(UIntegerUnderlying number);
+
+    Integer *UIntNew(const char *string, int base);
+}
+
+#endif // !ARGON_VM_DATATYPE_INTEGER_H_
\ No newline at end of file
@@ -0,0 +1,103 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#ifndef ARGON_VM_DATATYPE_PCHECK_H_
+#define ARGON_VM_DATATYPE_PCHECK_H_
+
+#include <argon/vm/datatype/arobject.h>
+#include <argon/vm/datatype/arstring.h>
+#include <argon/vm/datatype/dict.h>
+#include <argon/vm/datatype/tuple.h>
+
+namespace argon::vm::datatype {
+    /// Number of parameters covered by the PCheck::typed bitmap, the remaining ones are always checked.
+    constexpr unsigned short kPCheckMaskBits = sizeof(ArSize) * 8;
+
+    struct Param {
+        char *name;
+
+        /// Only accepted type if the parameter accepts exactly one type, otherwise nullptr.
+        const TypeInfo *expected;
+
+        const TypeInfo *types[];
+    };
+
+    struct PCheck {
+        AROBJ_HEAD;
+
+        unsigned short count;
+
+        /// Bitmap of the parameters that carry a type constraint (bit i -> params[i]).
+        ArSize typed;
+
+        Param **params;
+    };
+
+    _ARGONAPI extern const TypeInfo *type_pcheck_;
+
+    /**
+     * @brief Keyword arguments passed as a tuple of names and a slice of values (see OpCodeCallMode::KW_NAMES).
+     *
+     * It is passed only to natives declared with kFunctionKWArgsView (the others receive a Dict),
+     * it lives on the native stack for the duration of the call and is never reference counted.
+     */
+    struct KWArgs {
+        AROBJ_HEAD;
+
+        /// Tuple of interned strings.
+        Tuple *names;
+
+        /// Values, one for each name.
+        ArObject **values;
+    };
+    _ARGONAPI extern const TypeInfo *type_kwargs_;
+
+    PCheck *PCheckNew(const char *description);
+
+    bool VariadicCheckPositional(const char *name, unsigned int nargs, unsigned int min, unsigned int max);
+
+    /**
+     * @brief Look up a keyword argument passed as names/values.
+     *
+     * If a name is repeated, the last value wins.
+     *
+     * @param names Tuple of names.
+     * @param values Array of values.
+     * @param key Name to look up.
+     * @return A borrowed reference to the value, or nullptr if key was not passed.
+     */
+    ArObject *KWArgsLookup(const Tuple *names, ArObject **values, const String *key);
+
+    /**
+     * @brief Build a Dict from keyword arguments passed as names/values.
+     *
+     * @param names Tuple of names.
+     * @param values Array of values.
+     * @return A pointer to the new Dict, otherwise nullptr.
+     */
+    Dict *KWArgsToDict(const Tuple *names, ArObject **values);
+
+    // KWParameters utilities
+    // kwargs is what the native received: a Dict or a KWArgs view (kFunctionKWArgsView), any other type is a TypeError
+    _ARGONAPI bool KParamLookup(Dict *kwargs, const char *key, const TypeInfo *type, ArObject **out, ArObject *_default, bool nil_as_default);
+
+    _ARGONAPI bool KParamLookupBool(Dict *kwargs, const char *key, bool *out, bool _default);
+
+    _ARGONAPI bool KParamLookupInt(Dict *kwargs, const char *key, IntegerUnderlying *out, IntegerUnderlying _default);
+
+    _ARGONAPI bool KParamLookupStr(Dict *kwargs, const char *key, String **out, const char *_default, bool *out_isdef);
+
+    _ARGONAPI bool KParamLookupUInt(Dict *kwargs, const char *key, UIntegerUnderlying *out, UIntegerUnderlying _default);
+
+    /**
+     * @brief Returns the kwargs received by a native function as a Dict.
+     *
+     * @param kwargs Dict or KWArgs received by a native function.
+     * @return A new reference to a Dict, otherwise nullptr.
+     */
+    _ARGONAPI Dict *KParamToDict(ArObject *kwargs);
+
+} // namespace argon::vm::datatype
+
+#endif // !ARGON_VM_DATATYPE_PCHECK_H_
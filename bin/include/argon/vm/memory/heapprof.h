@@ -0,0 +1,156 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#ifndef ARGON_VM_MEMORY_HEAPPROF_H_
+#define ARGON_VM_MEMORY_HEAPPROF_H_
+
+#include <atomic>
+#include <cstddef>
+
+namespace argon::vm::datatype {
+    struct ArObject;
+    struct Dict;
+    struct List;
+}
+
+namespace argon::vm::memory {
+    /// Default average number of allocated bytes between two samples.
+    constexpr const size_t kHeapProfDefaultRate = 128 * 1024;
+
+    extern std::atomic_bool heapprof_enabled;
+
+    /// Live sampled objects, the free path is skipped while there are none.
+    extern std::atomic_size_t heapprof_live;
+
+    /// Bytes that the current thread can still allocate before taking the next sample.
+    extern thread_local long long heapprof_countdown;
+
+    /// Incremented by HeapProfStart, the threads restart their countdown when it changes.
+    extern std::atomic_uint heapprof_session;
+
+    /// Session of heapprof_countdown.
+    extern thread_local unsigned int heapprof_thread_session;
+
+    /// Last memory block sampled by the current thread (see HeapProfTrackObject).
+    extern thread_local const void *heapprof_last_block;
+
+    /**
+     * @brief Check if the heap profiler was compiled in (see ARGON_FF_HEAPPROF).
+     *
+     * @return True if the heap profiler is available, false otherwise.
+     */
+    bool HeapProfIsAvailable();
+
+    /**
+     * @brief Check if the heap profiler is sampling new allocations.
+     *
+     * @return True if the heap profiler is running, false otherwise.
+     */
+    inline bool HeapProfIsEnabled() {
+        return heapprof_enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Compare two snapshots (see HeapProfSnapshot).
+     *
+     * @param old_snap Older snapshot.
+     * @param new_snap Newer snapshot.
+     * @return A list of tuples (type, site, count delta, bytes delta) sorted by bytes delta (largest growth first),
+     * entries that did not change are omitted. On error nullptr is returned and the panic state is set.
+     */
+    datatype::List *HeapProfDiff(datatype::Dict *old_snap, datatype::Dict *new_snap);
+
+    /**
+     * @brief Get a snapshot of the live objects.
+     *
+     * Counts and bytes are estimated from the samples (they are exact if the sampling rate is 1).
+     *
+     * @return A dict that maps (type, site) to (count, bytes), site is "qname:line" or nil if the allocation
+     * sites are not recorded. Memory blocks that do not hold an object (e.g. the items of a list) are reported
+     * with type "<raw>". On error nullptr is returned and the panic state is set.
+     */
+    datatype::Dict *HeapProfSnapshot();
+
+    /**
+     * @brief Start the heap profiler, the data collected by the previous session are discarded.
+     *
+     * @param rate Average number of allocated bytes between two samples (1: record every allocation).
+     * @param sites True to record the allocating code and line of each sample.
+     * @return True on success, false if the heap profiler is not available.
+     */
+    bool HeapProfStart(size_t rate, bool sites);
+
+    /**
+     * @brief Stop sampling new allocations and discard the samples and the sites collected so far.
+     *
+     * @return Previous state.
+     */
+    bool HeapProfStop();
+
+    /**
+     * @brief Record a sampled allocation.
+     *
+     * @param block Pointer to the new memory block.
+     * @param size Number of bytes allocated for the block.
+     */
+    void HeapProfSample(const void *block, size_t size);
+
+    /**
+     * @brief Attach the type of a new object to the sample of its memory block.
+     *
+     * @param object Pointer to the new object (type already set).
+     * @param block Pointer to the memory block that contains the object.
+     */
+    void HeapProfSetType(const datatype::ArObject *object, const void *block);
+
+    /**
+     * @brief Forget a sampled memory block.
+     *
+     * @param block Pointer to the memory block that is being released.
+     */
+    void HeapProfUntrack(const void *block);
+
+    /**
+     * @brief Must be called for every new memory block (see memory::Alloc), it periodically samples the allocation.
+     *
+     * Until HeapProfTrackObject is called, the sample counts as raw memory (e.g. the buffer of a string).
+     *
+     * @param block Pointer to the new memory block.
+     * @param size Number of bytes allocated for the block.
+     */
+    inline void HeapProfTrackAlloc(const void *block, size_t size) {
+        if (!HeapProfIsEnabled())
+            return;
+
+        // A countdown left by a previous session would delay the first samples of the new one
+        if ((heapprof_countdown -= (long long) size) > 0
+            && heapprof_thread_session == heapprof_session.load(std::memory_order_relaxed))
+            return;
+
+        HeapProfSample(block, size);
+    }
+
+    /**
+     * @brief Must be called for every new object, once its type is set.
+     *
+     * @param object Pointer to the new object.
+     * @param block Pointer to the memory block that contains the object (see HeapProfTrackAlloc).
+     */
+    inline void HeapProfTrackObject(const datatype::ArObject *object, const void *block) {
+        if (heapprof_live.load(std::memory_order_relaxed) > 0 && heapprof_last_block == block)
+            HeapProfSetType(object, block);
+    }
+
+    /**
+     * @brief Must be called before a memory block is released.
+     *
+     * @param block Pointer to the memory block that is being released.
+     */
+    inline void HeapProfTrackFree(const void *block) {
+        if (heapprof_live.load(std::memory_order_relaxed) > 0)
+            HeapProfUntrack(block);
+    }
+} // namespace argon::vm::memory
+
+#endif // !ARGON_VM_MEMORY_HEAPPROF_H_
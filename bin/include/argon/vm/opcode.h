@@ -0,0 +1,422 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#ifndef ARGON_VM_OPCODE_H_
+#define ARGON_VM_OPCODE_H_
+
+#include <atomic>
+
+#include <argon/util/enum_bitmask.h>
+
+namespace argon::vm {
+    using Instr32 = unsigned int;
+    using Instr16 = unsigned short;
+    using Instr8 = unsigned char;
+
+    inline unsigned char I16Arg(const unsigned char *instr) { return *((const Instr16 *) instr) >> (unsigned char) 8; }
+
+    inline unsigned int I32Arg(const unsigned char *instr) { return *((const Instr32 *) instr) >> (unsigned char) 8; }
+
+    template<typename T>
+    inline T I32Flag(const unsigned char *instr) {
+        return (T) (I32Arg(instr) >> (unsigned char) 16);
+    }
+
+    enum class OpCode : unsigned char {
+        ADD,
+        AWAIT,
+        CALL,
+        CMP,
+        CNT,
+        DEC,
+        DFR,
+        DIV,
+        DTMERGE,
+        DUP,
+        EQST,
+        EXTD,
+        IDIV,
+        IMPALL,
+        IMPFRM,
+        IMPMOD,
+        INC,
+        INIT,
+        INV,
+        IPADD,
+        IPSUB,
+        JEX,
+        JF,
+        JFOP,
+        JMP,
+        JNIL,
+        JNN,
+        JT,
+        JTOP,
+        LAND,
+        LDATTR,
+        LDENC,
+        LDGBL,
+        LDITER,
+        LDLC,
+        LDMETH,
+        LDSCOPE,
+        LOR,
+        LSTATIC,
+        LXOR,
+        MKBND,
+        MKDT,
+        MKFN,
+        MKLT,
+        MKST,
+        MKSTRUCT,
+        MKTP,
+        MKTRAIT,
+        MOD,
+        MTH,
+        MUL,
+        NEG,
+        NGV,
+        NOT,
+        NXT,
+        PANIC,
+        PLT,
+        POP,
+        POPC,
+        POPGT,
+        POS,
+        PSHC,
+        PSHN,
+        RET,
+        SHL,
+        SHR,
+        SPW,
+        ST,
+        STATTR,
+        STENC,
+        STGBL,
+        STLC,
+        STSCOPE,
+        STSUBSCR,
+        SUB,
+        SUBSCR,
+        SYNC,
+        TEST,
+        TRAP,
+        TSTORE,
+        UNPACK,
+        UNSYNC,
+        YLD,
+
+        // Specialized forms, they are never emitted by the compiler but are written
+        // by the interpreter in place of the generic instruction (quickening).
+        ADD_INT_INT,
+        CMP_INT_INT,
+        IPADD_INT,
+        IPADD_STR,
+        MUL_INT_INT,
+        SUB_INT_INT,
+
+        // Superinstructions, they replace the first instruction of a common pair (see FuseOpCode).
+        // The second instruction is left in place and is executed without being dispatched,
+        // so the layout of the bytecode does not change and jumps to the second instruction remain valid.
+        CMP_JF,
+        LDLC_LDATTR,
+        LDLC_LDLC,
+        LDMETH_CALL,
+        PSHC_POP
+    };
+
+    constexpr short StackChange[] = {
+            -1,
+            0,
+            0,
+            -1,
+            -1,
+            0,
+            -1,
+            -1,
+            -1,
+            0,
+            -1,
+            -1,
+            -1,
+            -1,
+            1,
+            1,
+            0,
+            0,
+            0,
+            -1,
+            -1,
+            0,
+            -1,
+            -1,
+            0,
+            0,
+            0,
+            -1,
+            -1,
+            -1,
+            0,
+            1,
+            1,
+            0,
+            1,
+            1,
+            0,
+            -1,
+            1,
+            -1,
+            -1,
+            1,
+            -2,
+            1,
+            1,
+            -3,
+            1,
+            -3,
+            -1,
+            0,
+            -1,
+            0,
+            -1,
+            0,
+            1,
+            -1,
+            -1,
+            -1,
+            0,
+            0,
+            0,
+            -1,
+            1,
+            -1,
+            -1,
+            -1,
+            -1,
+            0,
+            -2,
+            -1,
+            -1,
+            -1,
+            -2,
+            -3,
+            -1,
+            -1,
+            -1,
+            0,
+            0,
+            -2,
+            -1,
+            0,
+            -1,
+            -1,
+            -1,
+            -1,
+            -1,
+            -1,
+            -1,
+            -1,
+            1,
+            1,
+            1,
+            -1
+    };
+
+    constexpr short OpCodeOffset[] = {
+            1,
+            1,
+            4,
+            2,
+            2,
+            1,
+            4,
+            1,
+            1,
+            2,
+            2,
+            1,
+            1,
+            1,
+            4,
+            4,
+            1,
+            4,
+            1,
+            1,
+            1,
+            4,
+            4,
+            4,
+            4,
+            4,
+            4,
+            4,
+            4,
+            1,
+            4,
+            2,
+            4,
+            1,
+            2,
+            4,
+            4,
+            1,
+            4,
+            1,
+            1,
+            4,
+            4,
+            4,
+            4,
+            4,
+            4,
+            4,
+            1,
+            2,
+            1,
+            1,
+            4,
+            1,
+            1,
+            1,
+            1,
+            1,
+            1,
+            2,
+            1,
+            1,
+            1,
+            1,
+            1,
+            1,
+            4,
+            4,
+            4,
+            2,
+            4,
+            2,
+            4,
+            1,
+            1,
+            1,
+            1,
+            1,
+            4,
+            2,
+            2,
+            1,
+            1,
+            1,
+            2,
+            1,
+            1,
+            1,
+            1,
+            2,
+            2,
+            2,
+            4,
+            1
+    };
+
+    /**
+     * @brief Returns the superinstruction that can replace the first instruction of a pair.
+     *
+     * @param first Opcode of the first instruction (quickened forms are accepted).
+     * @param second Opcode of the instruction that immediately follows.
+     * @return Superinstruction opcode, or first if the pair cannot be fused.
+     */
+    constexpr OpCode FuseOpCode(OpCode first, OpCode second) {
+        switch (first) {
+            case OpCode::CMP:
+            case OpCode::CMP_INT_INT:
+                return second == OpCode::JF ? OpCode::CMP_JF : first;
+            case OpCode::LDLC:
+                if (second == OpCode::LDATTR)
+                    return OpCode::LDLC_LDATTR;
+
+                return second == OpCode::LDLC || second == OpCode::LDLC_LDATTR || second == OpCode::LDLC_LDLC
+                       ? OpCode::LDLC_LDLC : first;
+            case OpCode::LDMETH:
+                return second == OpCode::CALL ? OpCode::LDMETH_CALL : first;
+            case OpCode::PSHC:
+                return second == OpCode::POP ? OpCode::PSHC_POP : first;
+            default:
+                return first;
+        }
+    }
+
+    /**
+     * @brief Returns the generic instruction that a quickened opcode specializes.
+     *
+     * @param op Opcode.
+     * @return Generic opcode, or op if it is not a quickened form.
+     */
+    constexpr OpCode GenericOpCode(OpCode op) {
+        switch (op) {
+            case OpCode::ADD_INT_INT:
+                return OpCode::ADD;
+            case OpCode::CMP_INT_INT:
+                return OpCode::CMP;
+            case OpCode::IPADD_INT:
+            case OpCode::IPADD_STR:
+                return OpCode::IPADD;
+            case OpCode::MUL_INT_INT:
+                return OpCode::MUL;
+            case OpCode::SUB_INT_INT:
+                return OpCode::SUB;
+            default:
+                return op;
+        }
+    }
+
+    static_assert(sizeof(std::atomic<unsigned char>) == sizeof(unsigned char));
+
+    /**
+     * @brief Reads the opcode of an instruction.
+     *
+     * Opcodes can be rewritten while other fibers are executing the same code (quickening),
+     * for this reason they are always accessed atomically.
+     *
+     * @param instr Pointer to the instruction.
+     * @return Opcode.
+     */
+    inline OpCode LoadOpCode(const unsigned char *instr) {
+        return (OpCode) ((const std::atomic<unsigned char> *) instr)->load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Replaces the opcode of an instruction (see LoadOpCode).
+     *
+     * @param instr Pointer to the instruction.
+     * @param op New opcode, it must have the same layout as the current one.
+     */
+    inline void StoreOpCode(const unsigned char *instr, OpCode op) {
+        ((std::atomic<unsigned char> *) instr)->store((unsigned char) op, std::memory_order_relaxed);
+    }
+
+    enum class OpCodeInitMode : unsigned char {
+        POSITIONAL,
+        KWARGS
+    };
+
+    enum class OpCodeCallMode : unsigned char {
+        FASTCALL = 0,
+        REST_PARAMS = 1,
+        KW_PARAMS = 1 << 1u,
+
+        // Used with KW_PARAMS: keyword values are on the stack followed by a tuple with their names (instead of a Dict)
+        KW_NAMES = 1 << 2u
+    };
+
+    enum class OpCodeContainsMode : unsigned char {
+        IN,
+        NOT_IN
+    };
+} // namespace argon::vm
+
+ENUMBITMASK_ENABLE(argon::vm::OpCodeCallMode);
+
+#endif // !ARGON_VM_OPCODE_H_
@@ -0,0 +1,108 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#ifndef ARGON_VM_PROFILER_H_
+#define ARGON_VM_PROFILER_H_
+
+#include <atomic>
+
+#include <argon/vm/datatype/arstring.h>
+#include <argon/vm/datatype/code.h>
+
+#include <argon/vm/frame.h>
+
+namespace argon::vm::profiler {
+    /// Number of dispatched instructions between two time samples (per OS thread).
+    constexpr unsigned int kProfilerSampleInterval = 1024;
+
+    /// Max number of frames walked when sampling a call stack.
+    constexpr unsigned short kProfilerMaxDepth = 128;
+
+    struct ProfCode;
+
+    /// Per Eval state, it caches the record of the code that is being executed.
+    struct ProfState {
+        const datatype::Code *code;
+
+        ProfCode *record;
+
+        /// Profiler epoch in which record was looked up.
+        unsigned int epoch;
+
+        unsigned int ticks;
+    };
+
+    extern std::atomic_bool profiler_enabled;
+
+    /**
+     * @brief Check if the profiler is running.
+     *
+     * @return True if the profiler is collecting data, false otherwise.
+     */
+    inline bool IsEnabled() {
+        return profiler_enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Check if the profiler was compiled in (see ARGON_FF_PROFILER).
+     *
+     * @return True if the profiler is available, false otherwise.
+     */
+    bool IsAvailable();
+
+    /**
+     * @brief Start/stop collecting data.
+     *
+     * Starting the profiler discards the data of the previous session. Stopping it keeps the data available
+     * to the dump functions, but releases the profiled code objects.
+     *
+     * @param enable True to start the profiler, false to stop it.
+     * @return Previous state.
+     */
+    bool Enable(bool enable);
+
+    /**
+     * @brief Dump collected data as collapsed stacks (one line per stack: "f1;f2;f3 <microseconds>").
+     *
+     * @return A pointer to an Argon string object, otherwise nullptr.
+     */
+    datatype::String *DumpCollapsed();
+
+    /**
+     * @brief Dump collected data as JSON.
+     *
+     * Contains per-opcode execution counts, per-code calls, self/total time (microseconds) and per-line hit counts.
+     *
+     * @return A pointer to an Argon string object, otherwise nullptr.
+     */
+    datatype::String *DumpJSON();
+
+    /**
+     * @brief Must be called every time Eval starts/resumes on the current OS thread.
+     */
+    void EnterEval(ProfState *state);
+
+    /**
+     * @brief Discard the collected data and release the profiled code objects (the profiler state is not changed).
+     */
+    void Reset();
+
+    /**
+     * @brief Count a call of an Argon code.
+     *
+     * @param code Called code.
+     */
+    void TrackCall(const datatype::Code *code);
+
+    /**
+     * @brief Count the instruction pointed by frame->instr_ptr and periodically sample the call stack.
+     *
+     * @param state Pointer to the state of the current Eval.
+     * @param frame Pointer to the frame that is being executed.
+     */
+    void TrackInstr(ProfState *state, const Frame *frame);
+
+} // namespace argon::vm::profiler
+
+#endif // !ARGON_VM_PROFILER_H_
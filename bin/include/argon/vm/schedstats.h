@@ -0,0 +1,144 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#ifndef ARGON_VM_SCHEDSTATS_H_
+#define ARGON_VM_SCHEDSTATS_H_
+
+#include <atomic>
+#include <chrono>
+
+#include <argon/vm/datatype/stringbuilder.h>
+
+#ifdef ARGON_FF_SCHEDSTATS
+#define SCHEDSTAT_ADD(stats, field, value)  (stats).field.fetch_add(value, std::memory_order_relaxed)
+#define SCHEDSTAT_INC(stats, field)         SCHEDSTAT_ADD(stats, field, 1)
+#else
+#define SCHEDSTAT_ADD(stats, field, value)  ((void) 0)
+#define SCHEDSTAT_INC(stats, field)         ((void) 0)
+#endif
+
+namespace argon::vm::schedstats {
+    /// Buckets of the runnable-to-running latency histogram:
+    /// bucket 0 counts latencies < 1us, bucket i latencies in [2^(i-1), 2^i) us, the last one everything above.
+    constexpr unsigned short kLatencyBuckets = 24;
+
+    using StatCounter = std::atomic<unsigned long long>;
+
+    /// Counters owned by a VCore, they are updated by the OSThread that currently wires it.
+    struct VCoreStats {
+        /// Fibers dispatched (a fiber that is resumed N times counts N times).
+        StatCounter executed;
+
+        /// Fibers taken from the local queue.
+        StatCounter local;
+
+        /// Fibers taken from the global queue.
+        StatCounter global;
+
+        /// Fibers stolen from the local queue of another VCore.
+        StatCounter stolen;
+
+        /// Work stealing rounds that scanned all the other VCores without finding anything.
+        StatCounter failed_steals;
+
+        /// Local queue overflows, the fibers were moved to the global queue.
+        StatCounter overflows;
+
+        /// Runnable-to-running latency histogram (see kLatencyBuckets).
+        StatCounter latency[kLatencyBuckets];
+    };
+
+    /// Counters owned by an OSThread.
+    struct OSThreadStats {
+        /// Times the thread went to sleep.
+        StatCounter parks;
+
+        /// Times the thread was woken up.
+        StatCounter unparks;
+
+        /// Time spent looking for work to steal (nanoseconds).
+        StatCounter spinning_ns;
+
+        /// Blocking system calls that released the VCore (see EnterBlocking).
+        StatCounter blocking;
+
+        /// Fibers allocated from the local magazine.
+        StatCounter fiber_hits;
+
+        /// Fibers allocated after refilling the local magazine from the global pool.
+        StatCounter fiber_refills;
+
+        /// Fibers allocated from scratch (local magazine and global pool were empty).
+        StatCounter fiber_misses;
+
+        /// Fibers moved from the local magazine to the global pool (or freed) because the magazine was full.
+        StatCounter fiber_spills;
+
+        /// Start of the current spinning phase (only accessed by the owner thread).
+        unsigned long long spin_start;
+    };
+
+    /**
+     * @brief Get a monotonic timestamp.
+     *
+     * @return Timestamp in nanoseconds.
+     */
+    inline unsigned long long Now() {
+        return (unsigned long long) std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    /**
+     * @brief Add the counters of a VCore to another one (e.g. to compute totals).
+     *
+     * @param dst Stats that receive the sum.
+     * @param src Stats to add.
+     */
+    void Accumulate(VCoreStats *dst, const VCoreStats *src);
+
+    /**
+     * @brief Add the counters of an OSThread to another one (e.g. to compute totals).
+     *
+     * @param dst Stats that receive the sum.
+     * @param src Stats to add.
+     */
+    void Accumulate(OSThreadStats *dst, const OSThreadStats *src);
+
+    /**
+     * @brief Record a runnable-to-running latency sample.
+     *
+     * @param stats Stats of the VCore that runs the fiber.
+     * @param latency_ns Time spent by the fiber in the run queues (nanoseconds).
+     */
+    void RecordLatency(VCoreStats *stats, unsigned long long latency_ns);
+
+    /**
+     * @brief Write the counters of a VCore as JSON members (without the enclosing braces).
+     *
+     * @param builder StringBuilder that receives the data.
+     * @param stats VCore stats.
+     * @return True on success, false otherwise (see StringBuilder::GetError).
+     */
+    bool WriteVCoreStats(datatype::StringBuilder &builder, const VCoreStats *stats);
+
+    /**
+     * @brief Write the counters of an OSThread as JSON members (without the enclosing braces).
+     *
+     * @param builder StringBuilder that receives the data.
+     * @param stats OSThread stats.
+     * @return True on success, false otherwise (see StringBuilder::GetError).
+     */
+    bool WriteOSThreadStats(datatype::StringBuilder &builder, const OSThreadStats *stats);
+
+    /**
+     * @brief Write formatted data (at most 127 characters).
+     *
+     * @param builder StringBuilder that receives the data.
+     * @param format printf-like format string.
+     * @return True on success, false otherwise (see StringBuilder::GetError).
+     */
+    bool Write(datatype::StringBuilder &builder, const char *format, ...);
+} // namespace argon::vm::schedstats
+
+#endif // !ARGON_VM_SCHEDSTATS_H_
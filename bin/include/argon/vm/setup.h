@@ -0,0 +1,13 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#ifndef ARGON_VM_SETUP_H_
+#define ARGON_VM_SETUP_H_
+
+namespace argon::vm {
+    bool Setup();
+
+} // namespace argon::vm
+
+#endif // !ARGON_VM_SETUP_H_
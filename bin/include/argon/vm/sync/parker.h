@@ -0,0 +1,36 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#ifndef ARGON_VM_SYNC_PARKER_H_
+#define ARGON_VM_SYNC_PARKER_H_
+
+#include <atomic>
+
+namespace argon::vm::sync {
+    using ParkerWord = unsigned int;
+
+    /**
+     * @brief Binary semaphore used to park a single OS thread.
+     *
+     * Each OSThread owns a Parker, so a wakeup always targets exactly one thread.
+     * If Unpark is called before Park, the permit is kept and the next call to Park returns immediately
+     * (no wakeups can be lost between deciding to sleep and actually sleeping).
+     */
+    class Parker {
+        std::atomic<ParkerWord> permit_{};
+
+    public:
+        /**
+         * @brief Block the calling thread until a permit is available, then consume it.
+         */
+        void Park();
+
+        /**
+         * @brief Make a permit available, waking the parked thread (if any).
+         */
+        void Unpark();
+    };
+} // namespace argon::vm::sync
+
+#endif // !ARGON_VM_SYNC_PARKER_H_
@@ -0,0 +1,12 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#ifndef ARGON_VM_SYNC_H_
+#define ARGON_VM_SYNC_H_
+
+namespace argon::vm::sync {
+    using NotifyQueueTicket = unsigned long;
+}
+
+#endif // !ARGON_VM_SYNC_H_
\ No newline at end of file
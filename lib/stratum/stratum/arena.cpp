@@ -2,7 +2,10 @@
 //
 // Licensed under the Apache License v2.0
 
+#include <atomic>
 #include <cassert>
+#include <cstdlib>
+#include <mutex>
 
 #include <stratum/arena.h>
 #include <stratum/osmemory.h>
@@ -10,11 +13,142 @@
 
 using namespace stratum;
 
+/// Huge page region split into kStratumArenasPerRegion arenas.
+struct stratum::Region {
+    /// Beginning of the region (aligned to STRATUM_REGION_SIZE).
+    unsigned char *base;
+
+    /// Pointers to next region with at least one free slot.
+    Region *next;
+
+    /// Pointers to prev region with at least one free slot.
+    Region **prev;
+
+    /// Bitmask of the slots in use.
+    unsigned int used;
+
+    /// The region is backed by explicit huge pages (it cannot be partially purged).
+    bool hugetlb;
+};
+
+constexpr unsigned int kStratumRegionFull = (1u << kStratumArenasPerRegion) - 1;
+
+static_assert(STRATUM_REGION_SIZE % STRATUM_ARENA_SIZE == 0, "STRATUM_REGION_SIZE must be a multiple of STRATUM_ARENA_SIZE");
+static_assert(kStratumArenasPerRegion <= sizeof(unsigned int) * 8, "too many arenas per region");
+static_assert(kStratumPoolsAvailable <= sizeof(uint64_t) * 8, "the run bitmap cannot track all the pages of an arena");
+
+static std::atomic<ArenaMode> arena_mode = ArenaMode::PAGES;
+
+/* Regions with at least one free slot */
+static Region *regions = nullptr;
+static std::mutex m_regions;
+
+static void RegionPop(Region *region) {
+    if (region->next != nullptr)
+        region->next->prev = region->prev;
+
+    *region->prev = region->next;
+
+    region->next = nullptr;
+    region->prev = nullptr;
+}
+
+static void RegionPush(Region *region) {
+    region->next = regions;
+    region->prev = &regions;
+
+    if (regions != nullptr)
+        regions->prev = &region->next;
+
+    regions = region;
+}
+
+static Region *RegionNew(ArenaMode mode) {
+    void *mem = nullptr;
+    bool hugetlb = false;
+
+    if (mode == ArenaMode::HUGETLB && (mem = os::AllocHuge(STRATUM_REGION_SIZE)) != nullptr)
+        hugetlb = true;
+
+    if (mem == nullptr) {
+        if ((mem = os::AllocAligned(STRATUM_REGION_SIZE, STRATUM_REGION_SIZE)) == nullptr)
+            return nullptr;
+
+        os::AdviseHugePages(mem, STRATUM_REGION_SIZE);
+    }
+
+    auto *region = (Region *) malloc(sizeof(Region));
+    if (region == nullptr) {
+        os::Free(mem, STRATUM_REGION_SIZE);
+        return nullptr;
+    }
+
+    region->base = (unsigned char *) mem;
+    region->next = nullptr;
+    region->prev = nullptr;
+    region->used = 0;
+    region->hugetlb = hugetlb;
+
+    return region;
+}
+
+static void *RegionAllocSlot(ArenaMode mode, Region **out) {
+    std::unique_lock _(m_regions);
+
+    auto *region = regions;
+
+    if (region == nullptr) {
+        if ((region = RegionNew(mode)) == nullptr)
+            return nullptr;
+
+        RegionPush(region);
+    }
+
+    unsigned int slot = 0;
+    while (region->used & (1u << slot))
+        slot++;
+
+    region->used |= (1u << slot);
+
+    if (region->used == kStratumRegionFull)
+        RegionPop(region);
+
+    *out = region;
+
+    return region->base + (slot * STRATUM_ARENA_SIZE);
+}
+
+static void RegionFreeSlot(Region *region, void *mem) {
+    std::unique_lock _(m_regions);
+
+    auto slot = (unsigned int) (((unsigned char *) mem - region->base) / STRATUM_ARENA_SIZE);
+
+    if (region->used == kStratumRegionFull)
+        RegionPush(region);
+
+    region->used &= ~(1u << slot);
+
+    if (region->used == 0) {
+        RegionPop(region);
+
+        os::Free(region->base, STRATUM_REGION_SIZE);
+        free(region);
+    }
+}
+
 Arena *stratum::AllocArena() {
+    Region *region = nullptr;
     Arena *arena;
     void *mem;
 
-    if ((mem = stratum::os::Alloc(STRATUM_ARENA_SIZE)) == nullptr)
+    auto mode = arena_mode.load(std::memory_order_relaxed);
+
+    if (mode == ArenaMode::PAGES)
+        mem = stratum::os::Alloc(STRATUM_ARENA_SIZE);
+    else
+        mem = RegionAllocSlot(mode, &region);
+
+    if (mem == nullptr)
         return nullptr;
 
     // Arena was located in the last bytes of the first Pool
@@ -29,17 +163,41 @@ Arena *stratum::AllocArena() {
 
     arena->pool->arena = arena;
 
+    arena->runs = 0;
+    arena->region = region;
+    arena->idle_since = 0;
+
     arena->next = nullptr;
     arena->prev = nullptr;
 
     return arena;
 }
 
+Arena *stratum::AllocRunArena() {
+    auto *arena = AllocArena();
+
+    // The first page holds the arena header
+    if (arena != nullptr)
+        arena->runs = 1;
+
+    return arena;
+}
+
 void stratum::FreeArena(Arena *arena) {
     auto *mem = AlignDown(arena, STRATUM_PAGE_SIZE);
+
+    if (arena->region != nullptr) {
+        RegionFreeSlot(arena->region, mem);
+        return;
+    }
+
     stratum::os::Free(mem, STRATUM_ARENA_SIZE);
 }
 
+void stratum::SetArenaMode(ArenaMode mode) {
+    arena_mode = mode;
+}
+
 Pool *stratum::AllocPool(Arena *arena, size_t clazz) {
     size_t bytes = STRATUM_PAGE_SIZE - sizeof(Pool);
     auto *pool = arena->pool;
@@ -47,6 +205,7 @@ Pool *stratum::AllocPool(Arena *arena, size_t clazz) {
     assert(pool != nullptr);
 
     arena->free--;
+    arena->idle_since = 0;
 
     arena->pool = pool->next; // arena->pool = arena->pool->next
     if (arena->pool == nullptr && arena->free > 0) {
@@ -86,6 +245,100 @@ void stratum::FreePool(Pool *pool) {
     assert(arena->free <= arena->pools);
 }
 
+Pool *stratum::AllocRun(Arena *arena, unsigned int pages) {
+    auto *mem = (unsigned char *) AlignDown(arena, STRATUM_PAGE_SIZE);
+    uint64_t mask = (((uint64_t) 1) << pages) - 1;
+
+    assert(pages > 0 && pages <= STRATUM_RUN_MAX_PAGES);
+
+    for (unsigned int index = 1; index + pages <= kStratumPoolsAvailable; index++) {
+        if ((arena->runs & (mask << index)) != 0)
+            continue;
+
+        auto *run = (Pool *) (mem + (index * STRATUM_PAGE_SIZE));
+
+        run->arena = arena;
+        run->blocks = (unsigned short) pages;
+        run->free = 0;
+        run->blocksz = 0;
+        run->block = nullptr;
+        run->next = nullptr;
+        run->prev = nullptr;
+
+        arena->runs |= mask << index;
+        arena->free -= pages;
+        arena->idle_since = 0;
+
+        return run;
+    }
+
+    return nullptr;
+}
+
+bool stratum::ResizeRun(Pool *run, unsigned int pages) {
+    auto *arena = run->arena;
+    auto index = (unsigned int) (((unsigned char *) run - (unsigned char *) AlignDown(arena, STRATUM_PAGE_SIZE))
+                                 / STRATUM_PAGE_SIZE);
+
+    if (pages == run->blocks)
+        return true;
+
+    if (pages < run->blocks) {
+        uint64_t tail = ((((uint64_t) 1) << (run->blocks - pages)) - 1) << (index + pages);
+
+        arena->runs &= ~tail;
+        arena->free += run->blocks - pages;
+
+        run->blocks = (unsigned short) pages;
+
+        return true;
+    }
+
+    if (index + pages > kStratumPoolsAvailable)
+        return false;
+
+    uint64_t grow = ((((uint64_t) 1) << (pages - run->blocks)) - 1) << (index + run->blocks);
+    if ((arena->runs & grow) != 0)
+        return false;
+
+    arena->runs |= grow;
+    arena->free -= pages - run->blocks;
+
+    run->blocks = (unsigned short) pages;
+
+    return true;
+}
+
+void stratum::FreeRun(Pool *run) {
+    auto *arena = run->arena;
+    auto index = (unsigned int) (((unsigned char *) run - (unsigned char *) AlignDown(arena, STRATUM_PAGE_SIZE))
+                                 / STRATUM_PAGE_SIZE);
+
+    arena->runs &= ~(((((uint64_t) 1) << run->blocks) - 1) << index);
+    arena->free += run->blocks;
+    assert(arena->free <= arena->pools);
+}
+
+void stratum::PurgeArena(Arena *arena) {
+    auto *mem = (unsigned char *) AlignDown(arena, STRATUM_PAGE_SIZE);
+
+    assert(arena->free == arena->pools);
+
+    // The list of free pools is stored in the pages that are about to be discarded,
+    // restart from the first pool as AllocArena does (AllocPool extends the list lazily)
+    arena->pool = (Pool *) mem;
+
+    util::MemoryZero(arena->pool, sizeof(Pool));
+
+    arena->pool->arena = arena;
+    arena->idle_since = 0;
+
+    // The first page holds the arena header, keep it.
+    // Explicit huge pages cannot be partially released, they are returned with the whole region
+    if (arena->region == nullptr || !arena->region->hugetlb)
+        os::Purge(mem + STRATUM_PAGE_SIZE, STRATUM_ARENA_SIZE - STRATUM_PAGE_SIZE);
+}
+
 void *stratum::AllocBlock(Pool *pool) {
     void *block = pool->block;
 
@@ -19,6 +19,14 @@
 #define STRATUM_ARENA_SIZE         (256u << 10u)
 constexpr auto kStratumPoolsAvailable = STRATUM_ARENA_SIZE / STRATUM_PAGE_SIZE;
 
+/**
+ * @brief Size of the regions reserved when arenas are backed by huge pages (see ArenaMode).
+ *
+ * Must be a multiple of STRATUM_ARENA_SIZE and of the huge page size (2 MiB on x86-64).
+ */
+#define STRATUM_REGION_SIZE        (2u << 20u)
+constexpr auto kStratumArenasPerRegion = STRATUM_REGION_SIZE / STRATUM_ARENA_SIZE;
+
 /**
  * @brief Memory quantum.
  *
@@ -26,9 +34,21 @@ constexpr auto kStratumPoolsAvailable = STRATUM_ARENA_SIZE / STRATUM_PAGE_SIZE;
  */
 #define STRATUM_QUANTUM            8
 
-/// Maximum size of blocks managed by the memory pool.
+/// Maximum size of blocks of the quantum-spaced classes (8, 16, 24, ... 1024).
 #define STRATUM_BLOCK_MAX_SIZE     1024
-constexpr auto kStratumClasses = STRATUM_BLOCK_MAX_SIZE / STRATUM_QUANTUM;
+constexpr auto kStratumQuantumClasses = STRATUM_BLOCK_MAX_SIZE / STRATUM_QUANTUM;
+
+/// Sub-page classes above STRATUM_BLOCK_MAX_SIZE, pools of these classes hold 3 and 2 blocks (see ClassToSize).
+constexpr auto kStratumSubPageClasses = 2;
+constexpr auto kStratumClasses = kStratumQuantumClasses + kStratumSubPageClasses;
+
+/**
+ * @brief Maximum number of pages of a run.
+ *
+ * Blocks too big for the pool classes are served as runs of contiguous pages (see AllocRun), the first page
+ * of an arena holds the arena header so a run can span at most the remaining pages.
+ */
+#define STRATUM_RUN_MAX_PAGES      (kStratumPoolsAvailable - 1)
 
 /*
  * Stratum memory layout:
@@ -55,6 +75,19 @@ constexpr auto kStratumClasses = STRATUM_BLOCK_MAX_SIZE / STRATUM_QUANTUM;
  */
 
 namespace stratum {
+    /// How the memory of new arenas is obtained from the OS.
+    enum class ArenaMode {
+        /// Each arena is a separate mapping of regular pages.
+        PAGES,
+
+        /// Arenas are carved out of STRATUM_REGION_SIZE aligned regions advised for transparent huge pages.
+        TRANSPARENT_HUGE_PAGES,
+
+        /// Like TRANSPARENT_HUGE_PAGES, but the regions are backed by explicit huge pages (e.g. MAP_HUGETLB).
+        /// If the system has no huge pages available, falls back to TRANSPARENT_HUGE_PAGES.
+        HUGETLB
+    };
+
     struct alignas(STRATUM_QUANTUM)Arena {
         /// Total pools in the arena.
         unsigned int pools;
@@ -65,6 +98,15 @@ namespace stratum {
         /// Pointer to linked-list of available pools.
         struct Pool *pool;
 
+        /// Bitmap of the pages used by runs (only for the arenas that host runs, see AllocRunArena).
+        uint64_t runs;
+
+        /// Region that contains the arena (nullptr if the arena is a separate mapping).
+        struct Region *region;
+
+        /// Time (milliseconds) at which the arena became completely free, 0 if in use or already purged.
+        unsigned long long idle_since;
+
         /// Pointers to next arena.
         struct Arena *next;
 
@@ -76,13 +118,13 @@ namespace stratum {
         /// Pointer to Arena.
         Arena *arena;
 
-        /// Total blocks in pool.
+        /// Total blocks in pool (pages of a run).
         unsigned short blocks;
 
         /// Free blocks in pool.
         unsigned short free;
 
-        /// Size of single memory block.
+        /// Size of single memory block (0 if the header belongs to a run, see AllocRun).
         unsigned short blocksz;
 
         /// Pointer to linked-list of available blocks.
@@ -103,14 +145,74 @@ namespace stratum {
         return (void *) (((uintptr_t) ptr + sz) & ~(sz - 1));
     }
 
+    /**
+     * @brief Block size of the sub-page class that fits \p blocks blocks in a pool.
+     *
+     * The size is computed on the first pool of an arena, which is smaller because it also holds the arena header.
+     */
+    constexpr size_t SubPageClassSize(size_t blocks) {
+        return ((STRATUM_PAGE_SIZE - sizeof(Pool) - sizeof(Arena)) / blocks) & ~((size_t) STRATUM_QUANTUM - 1);
+    }
+
+    /// Maximum size of blocks managed by the memory pools, bigger blocks are served as runs (see AllocRun).
+    constexpr size_t kStratumPoolMaxSize = SubPageClassSize(kStratumSubPageClasses);
+
+    static_assert(SubPageClassSize(kStratumSubPageClasses + 1) > STRATUM_BLOCK_MAX_SIZE,
+                  "sub-page classes must be bigger than STRATUM_BLOCK_MAX_SIZE");
+
     inline size_t SizeToPoolClass(size_t size) {
+        if (size > STRATUM_BLOCK_MAX_SIZE)
+            return size > SubPageClassSize(kStratumSubPageClasses + 1)
+                   ? kStratumQuantumClasses + 1
+                   : kStratumQuantumClasses;
+
         return (((size + (STRATUM_QUANTUM - 1)) & ~((size_t) STRATUM_QUANTUM - 1)) / STRATUM_QUANTUM) - 1;
     }
 
     inline size_t ClassToSize(size_t clazz) {
+        if (clazz >= kStratumQuantumClasses)
+            return SubPageClassSize(kStratumSubPageClasses + 1 - (clazz - kStratumQuantumClasses));
+
         return STRATUM_QUANTUM + (STRATUM_QUANTUM * clazz);
     }
 
+    /**
+     * @brief Get the number of pages of the run that serves a block of \p size bytes.
+     *
+     * Runs are rounded up to geometric classes (four classes for each doubling), so that freed runs are
+     * more likely to fit the next requests.
+     *
+     * @param size Memory size required.
+     * @return Number of pages, 0 if the block is too big for a run.
+     */
+    inline unsigned int SizeToRunPages(size_t size) {
+        auto pages = (unsigned int) ((size + sizeof(Pool) + (STRATUM_PAGE_SIZE - 1)) / STRATUM_PAGE_SIZE);
+
+        if (pages > 4) {
+            unsigned int step = 1;
+
+            while ((step << 3u) <= pages)
+                step <<= 1u;
+
+            pages = (pages + (step - 1)) & ~(step - 1);
+        }
+
+        if (pages > STRATUM_RUN_MAX_PAGES) {
+            // The last class is cut at the arena boundary
+            if ((size + sizeof(Pool) + (STRATUM_PAGE_SIZE - 1)) / STRATUM_PAGE_SIZE > STRATUM_RUN_MAX_PAGES)
+                return 0;
+
+            pages = STRATUM_RUN_MAX_PAGES;
+        }
+
+        return pages;
+    }
+
+    /// Usable size of a run.
+    inline size_t RunSize(const Pool *run) {
+        return (run->blocks * STRATUM_PAGE_SIZE) - sizeof(Pool);
+    }
+
     inline bool AddressInArenas(const void *ptr) {
         const auto *p = (Pool *) AlignDown(ptr, STRATUM_PAGE_SIZE);
         return p->arena != nullptr
@@ -120,12 +222,62 @@ namespace stratum {
 
     Arena *AllocArena();
 
+    /**
+     * @brief Set how the memory of the arenas allocated from now on is obtained (see ArenaMode).
+     *
+     * Arenas already allocated are not affected.
+     *
+     * @param mode Arena mode.
+     */
+    void SetArenaMode(ArenaMode mode);
+
     Pool *AllocPool(Arena *arena, size_t clazz);
 
+    /**
+     * @brief Allocate an arena that hosts runs instead of pools.
+     *
+     * @return Pointer to arena, nullptr otherwise.
+     */
+    Arena *AllocRunArena();
+
+    /**
+     * @brief Allocate a run of \p pages contiguous pages (first-fit).
+     *
+     * The run starts with a Pool header (blocksz = 0, blocks = number of pages), the block returned to the user
+     * follows the header, so AddressInArenas works as for the blocks of the pools.
+     *
+     * @param arena Arena that hosts runs (see AllocRunArena).
+     * @param pages Number of pages.
+     * @return Pointer to run header, nullptr if the arena does not have enough contiguous free pages.
+     */
+    Pool *AllocRun(Arena *arena, unsigned int pages);
+
     void FreeArena(Arena *arena);
 
     void FreePool(Pool *pool);
 
+    void FreeRun(Pool *run);
+
+    /**
+     * @brief Resize a run in place.
+     *
+     * A run can shrink or grow into the free pages that follow it in the arena.
+     *
+     * @param run Pointer to run header.
+     * @param pages New number of pages.
+     * @return True if the run has been resized, false otherwise.
+     */
+    bool ResizeRun(Pool *run, unsigned int pages);
+
+    /**
+     * @brief Return the pages of a completely free arena to the OS, the arena remains usable.
+     *
+     * All the pools of the arena MUST be free.
+     *
+     * @param arena Pointer to arena.
+     */
+    void PurgeArena(Arena *arena);
+
     void *AllocBlock(Pool *pool);
 
     void FreeBlock(Pool *pool, void *block);
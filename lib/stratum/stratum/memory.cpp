@@ -3,6 +3,7 @@
 // Licensed under the Apache License v2.0
 
 #include <cassert>
+#include <chrono>
 #include <cstdlib>
 
 #include <stratum/memutil.h>
@@ -38,17 +39,50 @@ struct Emb {
 
 Memory stratum::default_allocator;
 
+static unsigned long long NowMs() {
+    return (unsigned long long) std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+thread_local ThreadCache tcache;
+
+ThreadCache::~ThreadCache() {
+    if (this->owner != nullptr)
+        this->owner->FlushThreadCache();
+
+    // Frees issued by destructors that run after this one go straight to the shared pools
+    this->dead = true;
+}
+
 Arena *Memory::FindOrCreateArena() {
     Arena *arena = this->arenas_.FindFree();
 
     if (arena == nullptr) {
-        arena = AllocArena();
+        if ((arena = AllocArena()) == nullptr)
+            return nullptr;
+
         this->arenas_.Insert(arena);
     }
 
     return arena;
 }
 
+void Memory::DecayArenas(support::LinkedList<Arena> &arenas, unsigned long long &next, unsigned long long now,
+                         bool force) {
+    auto decay = (unsigned long long) this->decay_ms_.load(std::memory_order_relaxed);
+
+    if (decay == 0 || (!force && now < next))
+        return;
+
+    // Scanning all the arenas is not free, do it at most twice per decay period
+    next = now + (decay / 2 > 0 ? decay / 2 : 1);
+
+    for (auto *arena = arenas.First(); arena != nullptr; arena = arena->next) {
+        if (arena->idle_since != 0 && now - arena->idle_since >= decay)
+            PurgeArena(arena);
+    }
+}
+
 bool Memory::Initialize() {
     std::unique_lock lck(this->m_arenas_);
 
@@ -71,6 +105,31 @@ bool Memory::Initialize() {
     return true;
 }
 
+ThreadCache *Memory::GetThreadCache() {
+    auto *cache = &tcache;
+
+    if (cache->dead || this->tcache_disabled_.load(std::memory_order_relaxed))
+        return nullptr;
+
+    if (cache->owner == nullptr)
+        cache->owner = this;
+    else if (cache->owner != this)
+        return nullptr;
+
+    auto epoch = this->epoch_.load(std::memory_order_relaxed);
+    if (cache->epoch != epoch) {
+        // The arenas of the cached blocks have been released by Finalize
+        for (auto &bin: cache->bins) {
+            bin.head = nullptr;
+            bin.count = 0;
+        }
+
+        cache->epoch = epoch;
+    }
+
+    return cache;
+}
+
 Pool *Memory::AllocatePool(size_t clazz) {
     this->m_arenas_.lock();
 
@@ -83,11 +142,66 @@ Pool *Memory::AllocatePool(size_t clazz) {
 
     auto *pool = AllocPool(arena, clazz);
 
+    if (this->decay_ms_.load(std::memory_order_relaxed) > 0)
+        this->DecayArenas(this->arenas_, this->next_decay_, NowMs(), false);
+
     this->m_arenas_.unlock();
 
     return pool;
 }
 
+Pool *Memory::AllocateRun(unsigned int pages) {
+    std::unique_lock _(this->m_runs_);
+    Pool *run;
+
+    for (auto *arena = this->runs_.First(); arena != nullptr; arena = arena->next) {
+        if (arena->free >= pages && (run = AllocRun(arena, pages)) != nullptr)
+            return run;
+    }
+
+    auto *arena = AllocRunArena();
+    if (arena == nullptr)
+        return nullptr;
+
+    this->runs_.Insert(arena);
+
+    return AllocRun(arena, pages);
+}
+
+bool Memory::GrowRun(Pool *run, size_t size) {
+    auto pages = SizeToRunPages(size);
+
+    if (pages == 0)
+        return false;
+
+    std::unique_lock _(this->m_runs_);
+
+    return ResizeRun(run, pages);
+}
+
+void Memory::ReleaseRun(Pool *run) {
+    auto *arena = run->arena;
+
+    std::unique_lock _(this->m_runs_);
+
+    FreeRun(run);
+
+    if (arena->free != arena->pools)
+        return;
+
+    if (this->decay_ms_.load(std::memory_order_relaxed) > 0) {
+        auto now = NowMs();
+
+        arena->idle_since = now;
+
+        this->DecayArenas(this->runs_, this->next_decay_runs_, now, false);
+    } else if (this->runs_.Count() > 1) {
+        // Keep one arena, so that a run that is repeatedly allocated and released does not map/unmap memory
+        this->runs_.Remove(arena);
+        FreeArena(arena);
+    }
+}
+
 Pool *Memory::GetPool(size_t clazz) {
     Pool *pool = this->pools_[clazz];
 
@@ -129,12 +243,34 @@ void *Memory::AllocateBlockFromPool(size_t clazz) {
 }
 
 void *Memory::Alloc(size_t size) {
-    size_t clazz = SizeToPoolClass(size);
-
     assert(size > 0);
 
-    if (size <= STRATUM_BLOCK_MAX_SIZE)
-        return this->AllocateBlockFromPool(clazz);
+    if (size <= kStratumPoolMaxSize) {
+        size_t clazz = SizeToPoolClass(size);
+
+        auto *cache = this->GetThreadCache();
+        if (cache == nullptr)
+            return this->AllocateBlockFromPool(clazz);
+
+        auto *bin = cache->bins + clazz;
+
+        if (bin->count == 0 && this->RefillCacheBin(bin, clazz, CacheBinMax(clazz) / 2) == 0)
+            return nullptr;
+
+        void *block = bin->head;
+
+        bin->head = *((void **) block);
+        bin->count--;
+
+        return block;
+    }
+
+    auto pages = SizeToRunPages(size);
+    if (pages > 0) {
+        auto *run = this->AllocateRun(pages);
+
+        return run != nullptr ? ((unsigned char *) run) + sizeof(Pool) : nullptr;
+    }
 
     unsigned char *ptr;
     if ((ptr = (unsigned char *) malloc(size + sizeof(Emb) + STRATUM_QUANTUM)) == nullptr)
@@ -165,11 +301,33 @@ void *Memory::Calloc(size_t num, size_t size) {
     return area;
 }
 
+void Memory::Decay() {
+    if (this->decay_ms_.load(std::memory_order_relaxed) == 0)
+        return;
+
+    auto now = NowMs();
+
+    std::unique_lock lck(this->m_arenas_);
+
+    this->DecayArenas(this->arenas_, this->next_decay_, now, true);
+
+    lck.unlock();
+
+    std::unique_lock _(this->m_runs_);
+
+    this->DecayArenas(this->runs_, this->next_decay_runs_, now, true);
+}
+
 void Memory::Finalize() {
     Arena *arena;
 
+    this->epoch_++;
+
     while ((arena = this->arenas_.Pop()) != nullptr)
         FreeArena(arena);
+
+    while ((arena = this->runs_.Pop()) != nullptr)
+        FreeArena(arena);
 }
 
 void Memory::Free(void *ptr) {
@@ -179,7 +337,29 @@ void Memory::Free(void *ptr) {
     auto *pool = (Pool *) AlignDown(ptr, STRATUM_PAGE_SIZE);
 
     if (AddressInArenas(ptr)) {
+        if (pool->blocksz == 0) {
+            this->ReleaseRun(pool);
+            return;
+        }
+
         size_t clazz = SizeToPoolClass(pool->blocksz);
+
+        auto *cache = this->GetThreadCache();
+        if (cache != nullptr) {
+            auto *bin = cache->bins + clazz;
+            auto max = CacheBinMax(clazz);
+
+            if (bin->count == max)
+                this->FlushCacheBin(bin, clazz, max / 2);
+
+            *((void **) ptr) = bin->head;
+
+            bin->head = ptr;
+            bin->count++;
+
+            return;
+        }
+
         auto *m_pool = this->m_pools_ + clazz;
 
         m_pool->lock();
@@ -196,6 +376,85 @@ void Memory::Free(void *ptr) {
     free(((unsigned char *) ptr) - emb->offset);
 }
 
+void Memory::FlushCacheBin(CacheBin *bin, size_t clazz, unsigned short count) {
+    void **link = &bin->head;
+    void *cursor;
+
+    if (count == 0 || count > bin->count)
+        return;
+
+    // The most recently freed blocks are at the head of the list (and probably still in the CPU cache),
+    // keep them and return the oldest ones
+    for (unsigned short i = 0; i < bin->count - count; i++)
+        link = (void **) *link;
+
+    cursor = *link;
+    *link = nullptr;
+
+    bin->count -= count;
+
+    auto *m_pool = this->m_pools_ + clazz;
+
+    m_pool->lock();
+
+    while (cursor != nullptr) {
+        auto *next = *((void **) cursor);
+        auto *pool = (Pool *) AlignDown(cursor, STRATUM_PAGE_SIZE);
+
+        FreeBlock(pool, cursor);
+        this->TryReleaseMemory(pool, clazz);
+
+        cursor = next;
+    }
+
+    m_pool->unlock();
+}
+
+void Memory::FlushThreadCache() {
+    auto *cache = &tcache;
+
+    if (cache->owner != this || cache->epoch != this->epoch_.load(std::memory_order_relaxed))
+        return;
+
+    for (size_t i = 0; i < kStratumClasses; i++)
+        this->FlushCacheBin(cache->bins + i, i, cache->bins[i].count);
+}
+
+unsigned short Memory::RefillCacheBin(CacheBin *bin, size_t clazz, unsigned short count) {
+    auto *m_pool = this->m_pools_ + clazz;
+    unsigned short filled = 0;
+
+    m_pool->lock();
+
+    while (filled < count) {
+        auto *pool = GetPool(clazz);
+        if (pool == nullptr)
+            break;
+
+        while (pool->free > 0 && filled < count) {
+            auto *block = AllocBlock(pool);
+
+            *((void **) block) = bin->head;
+            bin->head = block;
+
+            filled++;
+        }
+
+        if (pool->free == 0) {
+            POP_FROM_LIST(pool);
+
+            pool->next = nullptr;
+            pool->prev = nullptr;
+        }
+    }
+
+    m_pool->unlock();
+
+    bin->count += filled;
+
+    return filled;
+}
+
 void *Memory::Realloc(void *ptr, size_t size) {
     void *tmp;
     size_t src_sz;
@@ -203,21 +462,32 @@ void *Memory::Realloc(void *ptr, size_t size) {
     if (ptr == nullptr)
         return this->Alloc(size);
 
-    const auto *pool = (Pool *) AlignDown(ptr, STRATUM_PAGE_SIZE);
+    auto *pool = (Pool *) AlignDown(ptr, STRATUM_PAGE_SIZE);
 
     if (AddressInArenas(ptr)) {
-        size_t actual = SizeToPoolClass(pool->blocksz);
-        size_t desired = SizeToPoolClass(size);
-        src_sz = pool->blocksz;
-
-        if (actual > desired && (actual - desired < STRATUM_REALLOC_THRESHOLD))
-            return ptr;
+        if (pool->blocksz == 0) {
+            src_sz = RunSize(pool);
+
+            // Shrink or grow into the following free pages
+            if (size > kStratumPoolMaxSize && this->GrowRun(pool, size))
+                return ptr;
+        } else {
+            src_sz = pool->blocksz;
+
+            if (size <= kStratumPoolMaxSize) {
+                size_t actual = SizeToPoolClass(pool->blocksz);
+                size_t desired = SizeToPoolClass(size);
+
+                if (actual > desired && (actual - desired < STRATUM_REALLOC_THRESHOLD))
+                    return ptr;
+            }
+        }
     } else {
         const auto *emb = (Emb *) (((unsigned char *) ptr) - sizeof(Emb));
 
         src_sz = emb->size;
 
-        if (size > STRATUM_BLOCK_MAX_SIZE && src_sz >= size)
+        if (size > kStratumPoolMaxSize && src_sz >= size)
             return ptr;
     }
 
@@ -229,6 +499,14 @@ void *Memory::Realloc(void *ptr, size_t size) {
     return tmp;
 }
 
+void Memory::SetDecay(unsigned int milliseconds) {
+    this->decay_ms_ = milliseconds;
+}
+
+void Memory::SetThreadCache(bool enable) {
+    this->tcache_disabled_ = !enable;
+}
+
 void Memory::TryReleaseMemory(Pool *pool, size_t clazz) {
     Arena *arena = pool->arena;
 
@@ -242,7 +520,16 @@ void Memory::TryReleaseMemory(Pool *pool, size_t clazz) {
 
         if (arena->free != arena->pools)
             this->arenas_.Sort(arena);
-        else if (this->arenas_.Count() > STRATUM_MINIMUM_POOL) {
+        else if (this->decay_ms_.load(std::memory_order_relaxed) > 0) {
+            auto now = NowMs();
+
+            // Keep it mapped, it will be purged if it is still unused after the decay time.
+            // Move it after the arenas in use, so that they are preferred for new pools
+            arena->idle_since = now;
+            this->arenas_.Sort(arena);
+
+            this->DecayArenas(this->arenas_, this->next_decay_, now, false);
+        } else if (this->arenas_.Count() > STRATUM_MINIMUM_POOL) {
             this->arenas_.Remove(arena);
             FreeArena(arena);
         }
@@ -274,6 +561,10 @@ void *stratum::Realloc(void *ptr, size_t size) {
     return default_allocator.Realloc(ptr, size);
 }
 
+void stratum::Decay() {
+    default_allocator.Decay();
+}
+
 bool stratum::Initialize() {
     return default_allocator.Initialize();
 }
@@ -281,3 +572,7 @@ bool stratum::Initialize() {
 void stratum::Finalize() {
     default_allocator.Finalize();
 }
+
+void stratum::SetDecay(unsigned int milliseconds) {
+    default_allocator.SetDecay(milliseconds);
+}
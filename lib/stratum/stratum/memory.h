@@ -6,6 +6,7 @@
 #ifndef STRATUM_MEMORY_H_
 #define STRATUM_MEMORY_H_
 
+#include <atomic>
 #include <cstddef>
 #include <mutex>
 #include <new>
@@ -13,29 +14,105 @@
 #include <stratum/arena.h>
 #include <stratum/support/linklist.h>
 
-/* Minimum number of arenas, Stratum WILL NEVER release this memory to the OS. */
+/* Minimum number of arenas, Stratum WILL NEVER release this memory to the OS (unless a decay time is set, see
+ * Memory::SetDecay). */
 #define STRATUM_MINIMUM_POOL       16
 
 #define STRATUM_REALLOC_THRESHOLD  10
 
+/* Per-thread cache: maximum bytes cached for each size-class (clamped between STRATUM_TCACHE_BIN_MIN and
+ * STRATUM_TCACHE_BIN_MAX blocks). Blocks move between the thread cache and the shared pools in batches of half a bin. */
+#define STRATUM_TCACHE_BIN_BYTES   8192
+#define STRATUM_TCACHE_BIN_MIN     8
+#define STRATUM_TCACHE_BIN_MAX     64
+
 namespace stratum {
+    class Memory;
+
+    /// Free blocks of a single size-class cached by a thread.
+    struct CacheBin {
+        /// Linked-list of free blocks (the first word of each block points to the next one).
+        void *head;
+
+        /// Number of blocks in the list.
+        unsigned short count;
+    };
+
+    /// Per-thread free-block caches, one for each size-class (see Memory::Alloc).
+    struct ThreadCache {
+        /// Memory instance that owns the cache (only one instance per thread can use the cache).
+        Memory *owner;
+
+        /// Value of Memory::epoch_ when the cache was filled, cached blocks of a finalized instance are discarded.
+        unsigned int epoch;
+
+        /// The thread is exiting, the cache has been flushed and can no longer be used.
+        bool dead;
+
+        CacheBin bins[kStratumClasses];
+
+        ~ThreadCache();
+    };
+
+    inline unsigned short CacheBinMax(size_t clazz) {
+        auto blocks = STRATUM_TCACHE_BIN_BYTES / ClassToSize(clazz);
+
+        if (blocks < STRATUM_TCACHE_BIN_MIN)
+            return STRATUM_TCACHE_BIN_MIN;
+
+        return blocks > STRATUM_TCACHE_BIN_MAX ? STRATUM_TCACHE_BIN_MAX : (unsigned short) blocks;
+    }
+
     class Memory {
         /* Arena Linked-List */
         support::LinkedList<Arena> arenas_;
         std::mutex m_arenas_;
 
+        /* Arenas that host runs (blocks bigger than kStratumPoolMaxSize, see AllocRun) */
+        support::LinkedList<Arena> runs_;
+        std::mutex m_runs_;
+
         /* Memory pools organized by size-class */
         Pool *pools_[kStratumClasses];
         std::mutex m_pools_[kStratumClasses];
 
+        /* Incremented by Finalize, invalidates the blocks still held by the thread caches */
+        std::atomic_uint epoch_;
+
+        std::atomic_bool tcache_disabled_;
+
+        /* Idle time after which a free arena is purged (0 = disabled), see SetDecay */
+        std::atomic_uint decay_ms_;
+
+        /* Time (milliseconds) of the next scan for idle arenas, protected by m_arenas_ */
+        unsigned long long next_decay_;
+
+        /* Like next_decay_ but for runs_, protected by m_runs_ */
+        unsigned long long next_decay_runs_;
+
         Arena *FindOrCreateArena();
 
+        void DecayArenas(support::LinkedList<Arena> &arenas, unsigned long long &next, unsigned long long now,
+                         bool force);
+
+        ThreadCache *GetThreadCache();
+
         Pool *AllocatePool(size_t clazz);
 
+        Pool *AllocateRun(unsigned int pages);
+
+        bool GrowRun(Pool *run, size_t size);
+
+        void ReleaseRun(Pool *run);
+
         Pool *GetPool(size_t clazz);
 
         void *AllocateBlockFromPool(size_t clazz);
 
+        unsigned short RefillCacheBin(CacheBin *bin, size_t clazz, unsigned short count);
+
+        void FlushCacheBin(CacheBin *bin, size_t clazz, unsigned short count);
+
         void TryReleaseMemory(Pool *pool, size_t clazz);
 
     public:
@@ -53,8 +130,11 @@ namespace stratum {
          * @brief Allocates a block of size bytes of memory, returning a pointer to the beginning of the block.
          *
          * Allocates a block of memory aligned to the value of STRATUM_QUANTUM.
-         * If the requested size is greater than STRATUM_BLOCK_MAX_SIZE the memory is allocated by calling
-         * standard malloc and aligning the returned value to STRATUM_QUANTUM.
+         * Small blocks are served from the cache of the calling thread, which refills from the shared pools
+         * in batches (see STRATUM_TCACHE_BIN_BYTES).
+         * Blocks bigger than kStratumPoolMaxSize are served as runs of contiguous pages (up to
+         * STRATUM_RUN_MAX_PAGES), bigger blocks are allocated by calling standard malloc and aligning
+         * the returned value to STRATUM_QUANTUM.
          *
          * @param size Memory size required.
          * @return A void * to the beginning of the allocated block.
@@ -110,16 +190,33 @@ namespace stratum {
             return this->Calloc(num, 1);
         }
 
+        /**
+         * @brief Purge the free arenas that have been idle for longer than the decay time (see SetDecay).
+         *
+         * The scan also runs automatically while memory is allocated and released, this call is useful
+         * when the program becomes idle.
+         */
+        void Decay();
+
         /**
          * @brief Release all memory managed by this instance of Memory.
          */
         void Finalize();
 
+        /**
+         * @brief Return all the blocks cached by the calling thread to the shared pools.
+         *
+         * The cache is flushed automatically when the thread exits.
+         */
+        void FlushThreadCache();
+
         /**
          * @brief Release a block of memory previously allocated by a call to Memory::Alloc, Memory::Calloc
          * or Memory::Realloc.
          *
          * Releases the previously allocated block of memory making it available again for further allocation.
+         * Small blocks are kept in the cache of the calling thread, when the cache overflows half of it
+         * is returned to the shared pools.
          * If the value of the pointer passed is nullptr, the call returns without doing anything.
          *
          * @param ptr Pointer to memory block to be freed.
@@ -141,6 +238,7 @@ namespace stratum {
          * @brief Changes the size of the memory block pointed to by ptr.
          *
          * The function may move the memory block to a new location (whose address is returned by the function).
+         * Runs are resized in place when the pages that follow them are free.
          * In case that ptr is a nullptr, the function behaves like Memory::Alloc, assigning a new block of size bytes
          * and returning a pointer to its beginning.
          *
@@ -149,6 +247,28 @@ namespace stratum {
          * @return A void * to the beginning of the allocated block.
          */
         void *Realloc(void *ptr, size_t size);
+
+        /**
+         * @brief Enable or disable the per-thread caches.
+         *
+         * When disabled, every small allocation locks the shared pool of its size-class.
+         * Blocks already cached are returned to the pools by FlushThreadCache (or at thread exit).
+         *
+         * @param enable True to enable the caches (default), false otherwise.
+         */
+        void SetThreadCache(bool enable);
+
+        /**
+         * @brief Set the decay policy of the free arenas.
+         *
+         * By default a completely free arena is kept forever if the instance has at most STRATUM_MINIMUM_POOL arenas,
+         * otherwise it is unmapped immediately.
+         * With a decay time, free arenas are kept mapped (so they can be reused without a system call) and
+         * their pages are returned to the OS (e.g. MADV_DONTNEED) once they have been idle for \p milliseconds.
+         *
+         * @param milliseconds Idle time before a free arena is purged (0 = disabled).
+         */
+        void SetDecay(unsigned int milliseconds);
     };
 
     extern Memory default_allocator;
@@ -192,6 +312,11 @@ namespace stratum {
         return Calloc(num, 1);
     }
 
+    /**
+     * @brief Like Memory::Decay but on the default instance.
+     */
+    void Decay();
+
     /**
      * @brief Initialize default instance of memory manager.
      *
@@ -230,6 +355,13 @@ namespace stratum {
      * @return A void * to the beginning of the allocated block.
      */
     void *Realloc(void *ptr, size_t size);
+
+    /**
+     * @brief Like Memory::SetDecay but on the default instance.
+     *
+     * @param milliseconds Idle time before a free arena is purged (0 = disabled).
+     */
+    void SetDecay(unsigned int milliseconds);
 } // namespace stratum
 
 #endif // !STRATUM_MEMORY_H_
@@ -4,28 +4,142 @@
 
 #include <stratum/osmemory.h>
 
+static thread_local int preferred_node = -1;
+
+void stratum::os::SetPreferredNode(int node) { preferred_node = node; }
+
 #if defined(_WIN32)
 
 #include <Windows.h>
+#include <cstdint>
 
 void *stratum::os::Alloc(size_t size) {
+    if (preferred_node >= 0)
+        return VirtualAllocExNuma(GetCurrentProcess(), nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE,
+                                  (DWORD) preferred_node);
+
     return VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
 }
 
+void *stratum::os::AllocAligned(size_t size, size_t alignment) {
+    // Reserve a larger range to find an aligned address, release it and try to map exactly there
+    // (another thread may take the address in the meantime, in that case retry)
+    for (int i = 0; i < 8; i++) {
+        void *mem = VirtualAlloc(nullptr, size + alignment, MEM_RESERVE, PAGE_NOACCESS);
+        if (mem == nullptr)
+            return nullptr;
+
+        auto aligned = (((uintptr_t) mem) + (alignment - 1)) & ~((uintptr_t) alignment - 1);
+
+        VirtualFree(mem, 0, MEM_RELEASE);
+
+        if ((mem = VirtualAlloc((void *) aligned, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE)) != nullptr)
+            return mem;
+    }
+
+    return nullptr;
+}
+
+void *stratum::os::AllocHuge(size_t size) {
+    // Requires the SeLockMemoryPrivilege, without it the call fails
+    return VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE | MEM_LARGE_PAGES, PAGE_READWRITE);
+}
+
+void stratum::os::AdviseHugePages(void *ptr, size_t size) {}
+
 void stratum::os::Free(void *ptr, size_t size) { VirtualFree(ptr, 0, MEM_RELEASE); }
 
+void stratum::os::Purge(void *ptr, size_t size) { VirtualAlloc(ptr, size, MEM_RESET, PAGE_READWRITE); }
+
 #elif defined(__gnu_linux__) || (defined(__APPLE__) && defined(__MACH__))
 
 #include <sys/mman.h>
 #include <cstdint>
 
+#if defined(__gnu_linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// From linux/mempolicy.h, avoids a dependency on libnuma
+#define STRATUM_MPOL_PREFERRED 1
+
+static void BindToNode(void *mem, size_t size, int node) {
+    unsigned long mask;
+
+    if (node < 0 || node >= (int) (sizeof(mask) * 8))
+        return;
+
+    mask = 1ul << node;
+
+    // The policy is only a hint, on failure the kernel default (first touch) applies
+    syscall(SYS_mbind, mem, size, STRATUM_MPOL_PREFERRED, &mask, sizeof(mask) * 8, 0);
+}
+#else
+static void BindToNode(void *mem, size_t size, int node) {}
+#endif
+
 void *stratum::os::Alloc(size_t size) {
     void *mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
     if ((uintptr_t) mem == -1) return nullptr;
+
+    if (preferred_node >= 0)
+        BindToNode(mem, size, preferred_node);
+
+    return mem;
+}
+
+void *stratum::os::AllocAligned(size_t size, size_t alignment) {
+    auto *mem = (unsigned char *) mmap(nullptr, size + alignment, PROT_READ | PROT_WRITE,
+                                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if ((uintptr_t) mem == -1) return nullptr;
+
+    // Trim the unaligned head and the excess tail
+    auto *aligned = (unsigned char *) ((((uintptr_t) mem) + (alignment - 1)) & ~((uintptr_t) alignment - 1));
+    auto head = (size_t) (aligned - mem);
+
+    if (head > 0)
+        munmap(mem, head);
+
+    if (alignment - head > 0)
+        munmap(aligned + size, alignment - head);
+
+    if (preferred_node >= 0)
+        BindToNode(aligned, size, preferred_node);
+
+    return aligned;
+}
+
+#if defined(MAP_HUGETLB)
+void *stratum::os::AllocHuge(size_t size) {
+    void *mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if ((uintptr_t) mem == -1) return nullptr;
+
+    if (preferred_node >= 0)
+        BindToNode(mem, size, preferred_node);
+
     return mem;
 }
+#else
+void *stratum::os::AllocHuge(size_t size) { return nullptr; }
+#endif
+
+void stratum::os::AdviseHugePages(void *ptr, size_t size) {
+#if defined(MADV_HUGEPAGE)
+    // Only a hint, THP may be disabled system-wide
+    madvise(ptr, size, MADV_HUGEPAGE);
+#endif
+}
 
 void stratum::os::Free(void *ptr, size_t size) { munmap(ptr, size); }
 
+void stratum::os::Purge(void *ptr, size_t size) {
+#if defined(__APPLE__)
+    // MADV_DONTNEED is only a hint on Darwin, MADV_FREE actually releases the pages
+    madvise(ptr, size, MADV_FREE);
+#else
+    madvise(ptr, size, MADV_DONTNEED);
+#endif
+}
+
 #endif
 
@@ -16,12 +16,60 @@ namespace stratum::os {
      */
     void *Alloc(size_t size);
 
+    /**
+     * @brief Reserve a region of free pages aligned to \p alignment.
+     *
+     * @param size Memory size required.
+     * @param alignment Alignment of the region (must be a power of two and a multiple of the page size).
+     * @return A void * to the beginning of the allocated block.
+     */
+    void *AllocAligned(size_t size, size_t alignment);
+
+    /**
+     * @brief Reserve a region backed by explicit huge pages (e.g. MAP_HUGETLB on Linux).
+     *
+     * The call fails if the platform does not support explicit huge pages or if there are not enough
+     * huge pages reserved by the system administrator.
+     *
+     * @param size Memory size required (must be a multiple of the huge page size).
+     * @return A void * to the beginning of the allocated block, nullptr otherwise.
+     */
+    void *AllocHuge(size_t size);
+
+    /**
+     * @brief Ask the OS to back a region with transparent huge pages (if supported).
+     *
+     * @param ptr Pointer to the beginning of the region.
+     * @param size Size of region.
+     */
+    void AdviseHugePages(void *ptr, size_t size);
+
     /**
      * @brief Release a page region of \p size previously allocated by a call to stratum::os::Alloc.
      * @param ptr Pointer to memory block to be freed.
      * @param size \p Size of region to release.
      */
     void Free(void *ptr, size_t size);
+
+    /**
+     * @brief Return the physical pages of a region to the OS while keeping the region reserved.
+     *
+     * The region remains accessible, its contents are undefined after the call.
+     *
+     * @param ptr Pointer to the beginning of the region (must be page aligned).
+     * @param size Size of region.
+     */
+    void Purge(void *ptr, size_t size);
+
+    /**
+     * @brief Set the NUMA node preferred for the pages reserved by the calling thread.
+     *
+     * The preference only applies to the regions reserved by subsequent calls to stratum::os::Alloc
+     * from the same thread (it is ignored on platforms without NUMA memory policies).
+     *
+     * @param node NUMA node index (-1 = no preference).
+     */
+    void SetPreferredNode(int node);
 } // namespace stratum::os
 
 #endif // !STRATUM_OSMEMORY_H_
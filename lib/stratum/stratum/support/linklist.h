@@ -35,6 +35,10 @@ namespace stratum::support {
             return obj;
         }
 
+        T *First() {
+            return this->list;
+        }
+
         T *Pop() {
             T *tmp = this->list;
             if (tmp == nullptr)
@@ -0,0 +1,95 @@
+// This source file is part of the Stratum project.
+//
+// Licensed under the Apache License v2.0
+
+// Multi-threaded alloc/free throughput of the default allocator, with and without the per-thread caches.
+//
+// Usage: StratumBenchAlloc [max_threads] [rounds]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include <stratum/memory.h>
+
+using namespace stratum;
+
+constexpr unsigned int kBatchSize = 256;
+
+void Worker(unsigned int rounds, unsigned int seed) {
+    void *blocks[kBatchSize];
+
+    for (unsigned int r = 0; r < rounds; r++) {
+        for (unsigned int i = 0; i < kBatchSize; i++) {
+            // Sizes between 8 and 512 bytes, mostly small (like Argon objects)
+            auto size = (size_t) 8 << ((seed + i * 7 + r) % 7);
+
+            blocks[i] = Alloc(size);
+            *((unsigned char *) blocks[i]) = (unsigned char) i;
+        }
+
+        // Release in a different order to mix the free-lists
+        for (unsigned int i = 0; i < kBatchSize; i += 2)
+            Free(blocks[i]);
+
+        for (unsigned int i = 1; i < kBatchSize; i += 2)
+            Free(blocks[i]);
+    }
+}
+
+double Run(unsigned int threads, unsigned int rounds) {
+    std::vector<std::thread> workers;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (unsigned int i = 0; i < threads; i++)
+        workers.emplace_back(Worker, rounds, i);
+
+    for (auto &worker: workers)
+        worker.join();
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    // Each round performs kBatchSize allocations and kBatchSize releases
+    return ((double) threads * rounds * kBatchSize * 2) / elapsed.count() / 1e6;
+}
+
+int main(int argc, char **argv) {
+    unsigned int max_threads = std::thread::hardware_concurrency();
+    unsigned int rounds = 20000;
+
+    if (argc > 1)
+        max_threads = (unsigned int) strtoul(argv[1], nullptr, 10);
+
+    if (argc > 2)
+        rounds = (unsigned int) strtoul(argv[2], nullptr, 10);
+
+    if (max_threads == 0)
+        max_threads = 1;
+
+    if (!Initialize()) {
+        fprintf(stderr, "unable to initialize the allocator\n");
+        return EXIT_FAILURE;
+    }
+
+    // Warm up the arenas
+    Run(1, rounds / 10 + 1);
+
+    printf("%8s %16s %16s %8s\n", "threads", "no tcache Mops/s", "tcache Mops/s", "speedup");
+
+    for (unsigned int threads = 1; threads <= max_threads; threads *= 2) {
+        default_allocator.SetThreadCache(false);
+        auto locked = Run(threads, rounds);
+
+        default_allocator.SetThreadCache(true);
+        auto cached = Run(threads, rounds);
+
+        printf("%8u %16.2f %16.2f %7.2fx\n", threads, locked, cached, cached / locked);
+    }
+
+    Finalize();
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,254 @@
+// This source file is part of the Stratum project.
+//
+// Licensed under the Apache License v2.0
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <stratum/memory.h>
+#include <stratum/memutil.h>
+
+using namespace stratum;
+
+TEST(Memory, AllocFree) {
+    ASSERT_TRUE(Initialize());
+
+    for (size_t size = 1; size <= STRATUM_BLOCK_MAX_SIZE * 2; size += 7) {
+        auto *block = (unsigned char *) Alloc(size);
+
+        ASSERT_NE(block, nullptr);
+        ASSERT_EQ(((uintptr_t) block) % STRATUM_QUANTUM, 0);
+
+        util::MemorySet(block, 0xAB, size);
+
+        for (size_t i = 0; i < size; i++)
+            ASSERT_EQ(block[i], 0xAB);
+
+        Free(block);
+    }
+}
+
+TEST(Memory, ThreadCacheReuse) {
+    auto *block = Alloc(64);
+
+    Free(block);
+
+    // The block is kept in the cache of this thread
+    ASSERT_EQ(Alloc(64), block);
+
+    Free(block);
+
+    default_allocator.FlushThreadCache();
+}
+
+TEST(Memory, ThreadCacheOverflow) {
+    std::vector<void *> blocks;
+
+    // Overflow the cache bin of the class several times
+    for (int i = 0; i < STRATUM_TCACHE_BIN_MAX * 8; i++)
+        blocks.push_back(Alloc(16));
+
+    for (auto *block: blocks)
+        Free(block);
+
+    blocks.clear();
+
+    for (int i = 0; i < STRATUM_TCACHE_BIN_MAX * 8; i++) {
+        auto *block = (uintptr_t *) Alloc(16);
+
+        *block = (uintptr_t) i;
+
+        blocks.push_back(block);
+    }
+
+    for (int i = 0; i < STRATUM_TCACHE_BIN_MAX * 8; i++)
+        ASSERT_EQ(*((uintptr_t *) blocks[i]), (uintptr_t) i);
+
+    for (auto *block: blocks)
+        Free(block);
+}
+
+TEST(Memory, MultiThreaded) {
+    constexpr int kThreads = 4;
+    constexpr int kBlocks = 512;
+
+    std::vector<std::thread> threads;
+    std::vector<void *> shared[kThreads];
+
+    for (int t = 0; t < kThreads; t++) {
+        threads.emplace_back([t, &shared] {
+            for (int round = 0; round < 16; round++) {
+                std::vector<unsigned char *> blocks;
+
+                for (int i = 0; i < kBlocks; i++) {
+                    auto size = (size_t) 8 + (i % 64) * 8;
+                    auto *block = (unsigned char *) Alloc(size);
+
+                    util::MemorySet(block, (unsigned char) t, size);
+                    blocks.push_back(block);
+                }
+
+                for (int i = 0; i < kBlocks; i++) {
+                    auto size = (size_t) 8 + (i % 64) * 8;
+
+                    for (size_t k = 0; k < size; k++)
+                        ASSERT_EQ(blocks[i][k], (unsigned char) t);
+
+                    // Keep some blocks alive, they are released by another thread
+                    if (round == 15 && i % 4 == 0)
+                        shared[t].push_back(blocks[i]);
+                    else
+                        Free(blocks[i]);
+                }
+            }
+        });
+    }
+
+    for (auto &thread: threads)
+        thread.join();
+
+    for (auto &blocks: shared) {
+        for (auto *block: blocks)
+            Free(block);
+    }
+}
+
+TEST(Memory, HugePageArenas) {
+    Memory memory{};
+    std::vector<void *> blocks;
+
+    SetArenaMode(ArenaMode::TRANSPARENT_HUGE_PAGES);
+
+    ASSERT_TRUE(memory.Initialize());
+
+    // Enough blocks to fill more than one region
+    for (int i = 0; i < kStratumPoolsAvailable * kStratumArenasPerRegion * 2; i++) {
+        auto *block = memory.Alloc(STRATUM_BLOCK_MAX_SIZE);
+
+        ASSERT_NE(block, nullptr);
+
+        util::MemorySet(block, 0xCD, STRATUM_BLOCK_MAX_SIZE);
+
+        auto *arena = ((Pool *) AlignDown(block, STRATUM_PAGE_SIZE))->arena;
+
+        ASSERT_NE(arena->region, nullptr);
+        ASSERT_EQ(((uintptr_t) AlignDown(arena, STRATUM_PAGE_SIZE)) % STRATUM_ARENA_SIZE, 0);
+
+        blocks.push_back(block);
+    }
+
+    for (auto *block: blocks)
+        memory.Free(block);
+
+    memory.Finalize();
+
+    SetArenaMode(ArenaMode::PAGES);
+}
+
+TEST(Memory, ArenaDecay) {
+    Memory memory{};
+    std::vector<unsigned char *> blocks;
+
+    memory.SetDecay(1);
+
+    ASSERT_TRUE(memory.Initialize());
+
+    for (int i = 0; i < kStratumPoolsAvailable * 4; i++)
+        blocks.push_back((unsigned char *) memory.Alloc(STRATUM_BLOCK_MAX_SIZE));
+
+    auto *arena = ((Pool *) AlignDown(blocks.back(), STRATUM_PAGE_SIZE))->arena;
+
+    for (auto *block: blocks)
+        memory.Free(block);
+
+    // The arena is kept mapped...
+    ASSERT_EQ(arena->free, arena->pools);
+    ASSERT_NE(arena->idle_since, 0);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+    // ...and purged once idle for longer than the decay time
+    memory.Decay();
+
+    ASSERT_EQ(arena->idle_since, 0);
+    ASSERT_EQ(arena->pool, AlignDown(arena, STRATUM_PAGE_SIZE));
+
+    // Purged arenas can be reused
+    blocks.clear();
+
+    for (int i = 0; i < kStratumPoolsAvailable * 4; i++) {
+        auto *block = (unsigned char *) memory.Alloc(STRATUM_BLOCK_MAX_SIZE);
+
+        util::MemorySet(block, (unsigned char) i, STRATUM_BLOCK_MAX_SIZE);
+
+        blocks.push_back(block);
+    }
+
+    for (int i = 0; i < kStratumPoolsAvailable * 4; i++) {
+        ASSERT_EQ(blocks[i][0], (unsigned char) i);
+        ASSERT_EQ(blocks[i][STRATUM_BLOCK_MAX_SIZE - 1], (unsigned char) i);
+
+        memory.Free(blocks[i]);
+    }
+
+    memory.Finalize();
+}
+
+TEST(Memory, MediumBlocks) {
+    std::vector<std::pair<unsigned char *, size_t>> blocks;
+
+    for (size_t size = STRATUM_BLOCK_MAX_SIZE; size <= STRATUM_ARENA_SIZE * 2; size += size / 3 + 1) {
+        auto *block = (unsigned char *) Alloc(size);
+
+        ASSERT_NE(block, nullptr);
+        ASSERT_EQ(((uintptr_t) block) % STRATUM_QUANTUM, 0);
+
+        // Everything up to the biggest run is served from the arenas
+        if (SizeToRunPages(size) > 0 || size <= kStratumPoolMaxSize)
+            ASSERT_TRUE(AddressInArenas(block));
+
+        util::MemorySet(block, (unsigned char) size, size);
+
+        blocks.emplace_back(block, size);
+    }
+
+    for (auto &[block, size]: blocks) {
+        ASSERT_EQ(block[0], (unsigned char) size);
+        ASSERT_EQ(block[size - 1], (unsigned char) size);
+
+        Free(block);
+    }
+}
+
+TEST(Memory, RunRealloc) {
+    Memory memory{};
+
+    auto *block = (unsigned char *) memory.Alloc(8192);
+
+    util::MemorySet(block, 0x5A, 8192);
+
+    // The pages that follow the run are free, it grows in place
+    auto *grown = (unsigned char *) memory.Realloc(block, 8192 * 2);
+
+    ASSERT_EQ(grown, block);
+
+    // Take the pages that follow the run, the next growth moves it
+    auto *barrier = memory.Alloc(kStratumPoolMaxSize + 1);
+
+    auto *moved = (unsigned char *) memory.Realloc(grown, 8192 * 4);
+
+    ASSERT_NE(moved, grown);
+
+    for (int i = 0; i < 8192; i++)
+        ASSERT_EQ(moved[i], 0x5A);
+
+    // Shrinking never moves a run
+    ASSERT_EQ(memory.Realloc(moved, 8192), moved);
+
+    memory.Free(moved);
+    memory.Free(barrier);
+
+    memory.Finalize();
+}
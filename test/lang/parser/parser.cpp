@@ -5,10 +5,10 @@
 #include <gtest/gtest.h>
 #include <codecvt>
 
-#include <argon/lang/parser/parser.h>
+#include <argon/lang/parser2/parser2.h>
 
 using namespace argon::lang::scanner;
-using namespace argon::lang::parser;
+using namespace argon::lang::parser2;
 
 TEST(Parser, EmptyInput) {
 
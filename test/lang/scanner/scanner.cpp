@@ -270,6 +270,9 @@ TEST(Scanner, Comment) {
     ASSERT_TRUE(scanner.NextToken(&token));
     ASSERT_TRUE(TkEqual(&token, TokenType::COMMENT_INLINE, 0, 1, 1, 15, 16, 1));
 
+    ASSERT_TRUE(scanner.NextToken(&token));
+    ASSERT_TRUE(TkEqual(&token, TokenType::END_OF_LINE, 15, 16, 1, 16, 1, 2));
+
     ASSERT_TRUE(scanner.NextToken(&token));
     ASSERT_TRUE(TkEqual(&token, TokenType::COMMENT_INLINE, 16, 1, 2, 29, 14, 2));
 
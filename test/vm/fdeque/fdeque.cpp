@@ -0,0 +1,184 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <argon/vm/fdeque.h>
+
+using namespace argon::vm;
+
+TEST(FiberDeque, FIFO) {
+    FiberDeque<8> deque;
+    auto fibers = std::make_unique<Fiber[]>(4);
+
+    EXPECT_TRUE(deque.IsEmpty());
+    EXPECT_EQ(deque.Dequeue(), nullptr);
+
+    for (int i = 0; i < 4; i++)
+        ASSERT_TRUE(deque.Enqueue(&fibers[i]));
+
+    // nullptr is accepted and ignored
+    ASSERT_TRUE(deque.Enqueue(nullptr));
+    EXPECT_EQ(deque.Size(), 4);
+
+    for (int i = 0; i < 4; i++)
+        EXPECT_EQ(deque.Dequeue(), &fibers[i]);
+
+    EXPECT_TRUE(deque.IsEmpty());
+}
+
+TEST(FiberDeque, Bounded) {
+    FiberDeque<4> deque;
+    auto fibers = std::make_unique<Fiber[]>(5);
+
+    for (int i = 0; i < 4; i++)
+        ASSERT_TRUE(deque.Enqueue(&fibers[i]));
+
+    EXPECT_FALSE(deque.Enqueue(&fibers[4]));
+    EXPECT_EQ(deque.Size(), 4);
+
+    EXPECT_EQ(deque.Dequeue(), &fibers[0]);
+    EXPECT_TRUE(deque.Enqueue(&fibers[4]));
+}
+
+TEST(FiberDeque, WrapAround) {
+    FiberDeque<4> deque;
+    auto fibers = std::make_unique<Fiber[]>(3);
+
+    // Top and bottom go well past the length of the buffer
+    for (int i = 0; i < 100; i++) {
+        for (int j = 0; j < 3; j++)
+            ASSERT_TRUE(deque.Enqueue(&fibers[j]));
+
+        for (int j = 0; j < 3; j++)
+            ASSERT_EQ(deque.Dequeue(), &fibers[j]);
+    }
+
+    EXPECT_TRUE(deque.IsEmpty());
+}
+
+TEST(FiberDeque, StealBatch) {
+    FiberDeque<8> deque;
+    Fiber *batch[8];
+    auto fibers = std::make_unique<Fiber[]>(5);
+
+    for (int i = 0; i < 5; i++)
+        deque.Enqueue(&fibers[i]);
+
+    ASSERT_EQ(deque.StealBatch(batch, 3), 3);
+
+    for (int i = 0; i < 3; i++)
+        EXPECT_EQ(batch[i], &fibers[i]);
+
+    // Only the remaining ones
+    ASSERT_EQ(deque.StealBatch(batch, 8), 2);
+    EXPECT_EQ(batch[0], &fibers[3]);
+    EXPECT_EQ(batch[1], &fibers[4]);
+
+    EXPECT_EQ(deque.StealBatch(batch, 8), 0);
+}
+
+TEST(FiberDeque, StealDequeue) {
+    FiberDeque<8> victim;
+    FiberDeque<8> thief;
+    auto fibers = std::make_unique<Fiber[]>(5);
+
+    for (int i = 0; i < 5; i++)
+        victim.Enqueue(&fibers[i]);
+
+    // Below the minimum length nothing is stolen
+    EXPECT_EQ(thief.StealDequeue(6, victim), nullptr);
+    EXPECT_EQ(victim.Size(), 5);
+
+    // Half rounded up: the first is returned, the others go to the thief
+    EXPECT_EQ(thief.StealDequeue(1, victim), &fibers[0]);
+    EXPECT_EQ(thief.Size(), 2);
+    EXPECT_EQ(victim.Size(), 2);
+
+    EXPECT_EQ(thief.Dequeue(), &fibers[1]);
+    EXPECT_EQ(thief.Dequeue(), &fibers[2]);
+    EXPECT_EQ(victim.Dequeue(), &fibers[3]);
+    EXPECT_EQ(victim.Dequeue(), &fibers[4]);
+
+    EXPECT_EQ(thief.StealDequeue(1, victim), nullptr);
+}
+
+TEST(FiberDeque, StealDequeueRoom) {
+    FiberDeque<4> victim;
+    FiberDeque<4> thief;
+    auto fibers = std::make_unique<Fiber[]>(7);
+
+    for (int i = 0; i < 4; i++)
+        victim.Enqueue(&fibers[i]);
+
+    for (int i = 4; i < 7; i++)
+        thief.Enqueue(&fibers[i]);
+
+    // The thief has room for one fiber only, that is returned to the caller
+    EXPECT_EQ(thief.StealDequeue(1, victim), &fibers[0]);
+    EXPECT_EQ(thief.Size(), 3);
+    EXPECT_EQ(victim.Size(), 3);
+}
+
+TEST(FiberDeque, ConcurrentConsumers) {
+    constexpr int kFibers = 200000;
+    constexpr int kThieves = 4;
+
+    FiberDeque<64> deque;
+    auto fibers = std::make_unique<Fiber[]>(kFibers);
+    auto taken = std::make_unique<std::atomic_int[]>(kFibers);
+    std::atomic_int consumed = 0;
+    std::atomic_bool done = false;
+
+    std::vector<std::thread> thieves;
+
+    for (int i = 0; i < kThieves; i++) {
+        thieves.emplace_back([&, i]() {
+            Fiber *batch[8];
+
+            while (!done.load() || !deque.IsEmpty()) {
+                unsigned int count;
+
+                // Half of the thieves use the batch API
+                if (i & 1)
+                    count = deque.StealBatch(batch, 8);
+                else
+                    count = (batch[0] = deque.Dequeue()) != nullptr ? 1 : 0;
+
+                for (unsigned int j = 0; j < count; j++)
+                    taken[batch[j] - fibers.get()].fetch_add(1);
+
+                consumed.fetch_add((int) count);
+            }
+        });
+    }
+
+    // The owner pushes and consumes too
+    for (int i = 0; i < kFibers; i++) {
+        while (!deque.Enqueue(&fibers[i])) {
+            auto *fiber = deque.Dequeue();
+
+            if (fiber != nullptr) {
+                taken[fiber - fibers.get()].fetch_add(1);
+                consumed.fetch_add(1);
+            }
+        }
+    }
+
+    done = true;
+
+    for (auto &thief: thieves)
+        thief.join();
+
+    ASSERT_EQ(consumed.load(), kFibers);
+
+    // Every fiber was taken exactly once
+    for (int i = 0; i < kFibers; i++)
+        ASSERT_EQ(taken[i].load(), 1) << "fiber " << i;
+}
@@ -0,0 +1,215 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <argon/vm/fiber.h>
+#include <argon/vm/frame.h>
+
+using namespace argon::vm;
+
+constexpr unsigned int kSlots = 16;
+constexpr unsigned long kFrameBytes = sizeof(Frame) + kSlots * sizeof(void *);
+
+// True if the frame lies in the inline stack or in one of the segments chained to the fiber
+bool InStack(Fiber *fiber, Frame *frame) {
+    auto *ptr = (unsigned char *) frame;
+
+    for (auto *chunk = fiber->chunk; chunk != nullptr; chunk = chunk->prev) {
+        if (ptr >= (unsigned char *) chunk->data && ptr + kFrameBytes <= (unsigned char *) chunk->data + chunk->size)
+            return true;
+    }
+
+    return ptr >= (unsigned char *) fiber->stack_begin
+           && ptr + kFrameBytes <= (unsigned char *) fiber->stack_begin + kFiberStackSize;
+}
+
+// Allocate frames until the current segment is full
+std::vector<Frame *> FillSegment(Fiber *fiber) {
+    std::vector<Frame *> frames;
+
+    while ((unsigned char *) fiber->stack_cur + kFrameBytes <= fiber->stack_end)
+        frames.push_back(fiber->FrameAlloc(kSlots, false));
+
+    return frames;
+}
+
+TEST(Fiber, InlineStack) {
+    auto *fiber = FiberNew(nullptr, kFiberStackSize);
+    ASSERT_NE(fiber, nullptr);
+
+    auto frames = FillSegment(fiber);
+    ASSERT_FALSE(frames.empty());
+
+    // Bump allocated on the inline stack
+    EXPECT_EQ(fiber->chunk, nullptr);
+    EXPECT_EQ((void *) frames[0], (void *) fiber->stack_begin);
+
+    for (size_t i = 1; i < frames.size(); i++)
+        EXPECT_EQ((unsigned char *) frames[i], (unsigned char *) frames[i - 1] + kFrameBytes);
+
+    for (auto i = frames.size(); i > 0; i--)
+        fiber->FrameDel(frames[i - 1]);
+
+    EXPECT_EQ(fiber->stack_cur, (void *) fiber->stack_begin);
+
+    FiberDel(fiber);
+}
+
+TEST(Fiber, DeepRecursion) {
+    auto *fiber = FiberNew(nullptr, kFiberStackSize);
+    ASSERT_NE(fiber, nullptr);
+
+    std::vector<Frame *> frames;
+
+    for (int i = 0; i < 5000; i++) {
+        auto *frame = fiber->FrameAlloc(kSlots, false);
+
+        ASSERT_NE(frame, nullptr);
+        ASSERT_EQ(frame->fiber_id, (datatype::ArSize) fiber);
+
+        frames.push_back(frame);
+    }
+
+    for (auto *frame: frames)
+        EXPECT_TRUE(InStack(fiber, frame));
+
+    // The first segment has the default size, each following one doubles up to kFiberChunkSizeMax
+    std::vector<unsigned int> sizes;
+    for (auto *chunk = fiber->chunk; chunk != nullptr; chunk = chunk->prev)
+        sizes.insert(sizes.begin(), chunk->size);
+
+    ASSERT_GT(sizes.size(), 3);
+    EXPECT_EQ(sizes[0], kFiberChunkSize);
+
+    for (size_t i = 1; i < sizes.size(); i++)
+        EXPECT_EQ(sizes[i], std::min(sizes[i - 1] * 2, kFiberChunkSizeMax));
+
+    // Unwind: every segment is popped, the last one is kept as a spare
+    for (auto i = frames.size(); i > 0; i--)
+        fiber->FrameDel(frames[i - 1]);
+
+    EXPECT_EQ(fiber->chunk, nullptr);
+    EXPECT_EQ(fiber->stack_cur, (void *) fiber->stack_begin);
+    EXPECT_EQ(fiber->stack_end, (void *) ((unsigned char *) fiber->stack_begin + kFiberStackSize));
+    EXPECT_NE(fiber->chunk_spare, nullptr);
+
+    FiberDel(fiber);
+}
+
+TEST(Fiber, SegmentBoundary) {
+    auto *fiber = FiberNew(nullptr, kFiberStackSize);
+    ASSERT_NE(fiber, nullptr);
+
+    auto frames = FillSegment(fiber);
+
+    // The next frame does not fit in the inline stack
+    auto *above = fiber->FrameAlloc(kSlots, false);
+    auto *chunk = fiber->chunk;
+
+    ASSERT_NE(chunk, nullptr);
+    EXPECT_EQ((void *) above, (void *) chunk->data);
+
+    // Segments are popped lazily: the chunk stays current until a frame below it is released
+    fiber->FrameDel(above);
+    EXPECT_EQ(fiber->chunk, chunk);
+
+    fiber->FrameDel(frames.back());
+    EXPECT_EQ(fiber->chunk, nullptr);
+    EXPECT_EQ(fiber->chunk_spare, chunk);
+
+    // Calls that bounce on the boundary reuse the spare segment
+    for (int i = 0; i < 100; i++) {
+        frames.back() = fiber->FrameAlloc(kSlots, false);
+        above = fiber->FrameAlloc(kSlots, false);
+
+        ASSERT_EQ(fiber->chunk, chunk);
+        ASSERT_EQ(fiber->chunk_spare, nullptr);
+        ASSERT_EQ((void *) above, (void *) chunk->data);
+
+        fiber->FrameDel(above);
+        fiber->FrameDel(frames.back());
+
+        ASSERT_EQ(fiber->chunk_spare, chunk);
+    }
+
+    for (auto i = frames.size() - 1; i > 0; i--)
+        fiber->FrameDel(frames[i - 1]);
+
+    FiberDel(fiber);
+}
+
+TEST(Fiber, ChunkSize) {
+    auto *fiber = FiberNew(nullptr, kFiberStackSize);
+    ASSERT_NE(fiber, nullptr);
+
+    fiber->chunk_size = 4 * kFiberChunkSize;
+
+    auto frames = FillSegment(fiber);
+
+    // The size of the first segment is set per fiber (see Spawn)
+    frames.push_back(fiber->FrameAlloc(kSlots, false));
+    ASSERT_NE(fiber->chunk, nullptr);
+    EXPECT_EQ(fiber->chunk->size, 4 * kFiberChunkSize);
+
+    // A frame bigger than the next segment gets a segment of its own size
+    constexpr unsigned int big_slots = kFiberChunkSizeMax / sizeof(void *);
+
+    auto *big = fiber->FrameAlloc(big_slots, false);
+    ASSERT_NE(big, nullptr);
+    EXPECT_EQ((void *) big, (void *) fiber->chunk->data);
+    EXPECT_GE(fiber->chunk->size, sizeof(Frame) + big_slots * sizeof(void *));
+
+    fiber->FrameDel(big);
+
+    for (auto i = frames.size(); i > 0; i--)
+        fiber->FrameDel(frames[i - 1]);
+
+    EXPECT_EQ(fiber->chunk, nullptr);
+
+    // Reset the default for the next user of the fiber
+    FiberResetStack(fiber);
+    EXPECT_EQ(fiber->chunk_size, 0);
+    EXPECT_EQ(fiber->chunk_spare, nullptr);
+
+    FiberDel(fiber);
+}
+
+TEST(Fiber, ChunkCache) {
+    FiberChunkCacheEnable();
+
+    auto *first = FiberNew(nullptr, kFiberStackSize);
+    auto *second = FiberNew(nullptr, kFiberStackSize);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+
+    auto frames = FillSegment(first);
+    frames.push_back(first->FrameAlloc(kSlots, false));
+
+    auto *chunk = first->chunk;
+    ASSERT_NE(chunk, nullptr);
+
+    for (auto i = frames.size(); i > 0; i--)
+        first->FrameDel(frames[i - 1]);
+
+    // The segments of a fiber go to the cache of the thread...
+    FiberResetStack(first);
+    EXPECT_EQ(first->chunk_spare, nullptr);
+
+    // ...and are given to the next fiber that outgrows its inline stack
+    frames = FillSegment(second);
+    frames.push_back(second->FrameAlloc(kSlots, false));
+
+    EXPECT_EQ(second->chunk, chunk);
+
+    for (auto i = frames.size(); i > 0; i--)
+        second->FrameDel(frames[i - 1]);
+
+    FiberDel(first);
+    FiberDel(second);
+
+    FiberChunkCacheFlush();
+}
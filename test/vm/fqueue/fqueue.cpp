@@ -0,0 +1,139 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include <argon/vm/fqueue.h>
+
+using namespace argon::vm;
+
+TEST(FiberQueue, FIFO) {
+    FiberQueue queue;
+    auto fibers = std::make_unique<Fiber[]>(3);
+
+    EXPECT_TRUE(queue.IsEmpty());
+    EXPECT_EQ(queue.Dequeue(), nullptr);
+
+    for (int i = 0; i < 3; i++)
+        ASSERT_TRUE(queue.Enqueue(&fibers[i]));
+
+    EXPECT_EQ(queue.Size(), 3);
+
+    for (int i = 0; i < 3; i++)
+        EXPECT_EQ(queue.Dequeue(), &fibers[i]);
+
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+TEST(FiberQueue, Limit) {
+    FiberQueue queue(3);
+    auto fibers = std::make_unique<Fiber[]>(4);
+
+    for (int i = 0; i < 3; i++)
+        ASSERT_TRUE(queue.Enqueue(&fibers[i]));
+
+    EXPECT_FALSE(queue.Enqueue(&fibers[3]));
+    EXPECT_FALSE(queue.InsertHead(&fibers[3]));
+    EXPECT_EQ(queue.Size(), 3);
+}
+
+TEST(FiberQueue, BatchEnqueue) {
+    FiberQueue queue(4);
+    Fiber *batch[5];
+    auto fibers = std::make_unique<Fiber[]>(5);
+
+    for (int i = 0; i < 5; i++)
+        batch[i] = &fibers[i];
+
+    // All or nothing
+    EXPECT_FALSE(queue.Enqueue(batch, 5));
+    EXPECT_TRUE(queue.IsEmpty());
+
+    // A batch that exactly fills the queue fits
+    ASSERT_TRUE(queue.Enqueue(batch, 4));
+    EXPECT_EQ(queue.Size(), 4);
+
+    for (int i = 0; i < 4; i++)
+        EXPECT_EQ(queue.Dequeue(), &fibers[i]);
+}
+
+TEST(FiberQueue, BatchDequeue) {
+    FiberQueue queue;
+    Fiber *batch[8];
+    auto fibers = std::make_unique<Fiber[]>(5);
+
+    for (int i = 0; i < 5; i++)
+        queue.Enqueue(&fibers[i]);
+
+    ASSERT_EQ(queue.Dequeue(batch, 3), 3);
+
+    for (int i = 0; i < 3; i++)
+        EXPECT_EQ(batch[i], &fibers[i]);
+
+    ASSERT_EQ(queue.Dequeue(batch, 8), 2);
+    EXPECT_EQ(batch[0], &fibers[3]);
+    EXPECT_EQ(batch[1], &fibers[4]);
+
+    EXPECT_TRUE(queue.IsEmpty());
+
+    // The queue is still usable once emptied by a batch
+    ASSERT_TRUE(queue.Enqueue(&fibers[0]));
+    EXPECT_EQ(queue.Dequeue(), &fibers[0]);
+}
+
+TEST(FiberQueue, InsertHead) {
+    FiberQueue queue;
+    auto fibers = std::make_unique<Fiber[]>(2);
+
+    queue.Enqueue(&fibers[0]);
+    queue.InsertHead(&fibers[1]);
+
+    EXPECT_EQ(queue.Dequeue(), &fibers[1]);
+    EXPECT_EQ(queue.Dequeue(), &fibers[0]);
+}
+
+TEST(FiberQueue, StealHalf) {
+    FiberQueue victim;
+    FiberQueue thief;
+    auto fibers = std::make_unique<Fiber[]>(5);
+
+    for (int i = 0; i < 5; i++)
+        victim.Enqueue(&fibers[i]);
+
+    EXPECT_EQ(thief.StealHalf(6, victim), 0);
+
+    ASSERT_EQ(thief.StealHalf(1, victim), 3);
+    EXPECT_EQ(victim.Size(), 2);
+    EXPECT_EQ(thief.Size(), 3);
+
+    // Every fiber is in exactly one of the two queues
+    int seen[5] = {};
+
+    for (auto *queue: {&victim, &thief}) {
+        Fiber *fiber;
+
+        while ((fiber = queue->Dequeue()) != nullptr)
+            seen[fiber - fibers.get()]++;
+    }
+
+    for (int i = 0; i < 5; i++)
+        EXPECT_EQ(seen[i], 1);
+}
+
+TEST(FiberQueue, Relinquish) {
+    FiberQueue queue;
+    auto fibers = std::make_unique<Fiber[]>(3);
+
+    for (int i = 0; i < 3; i++)
+        queue.Enqueue(&fibers[i]);
+
+    queue.Relinquish(&fibers[1]);
+
+    EXPECT_EQ(queue.Size(), 2);
+    EXPECT_EQ(queue.Dequeue(), &fibers[0]);
+    EXPECT_EQ(queue.Dequeue(), &fibers[2]);
+    EXPECT_TRUE(queue.IsEmpty());
+}
@@ -0,0 +1,118 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <argon/vm/sync/parker.h>
+
+using namespace argon::vm::sync;
+
+TEST(Parker, UnparkBeforePark) {
+    Parker parker;
+
+    // The permit is kept, Park returns immediately
+    parker.Unpark();
+    parker.Park();
+
+    // At most one permit: the second Unpark is absorbed by the first
+    parker.Unpark();
+    parker.Unpark();
+    parker.Park();
+
+    std::atomic_bool woken = false;
+
+    std::thread sleeper([&parker, &woken]() {
+        parker.Park();
+        woken = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(woken);
+
+    parker.Unpark();
+    sleeper.join();
+
+    EXPECT_TRUE(woken);
+}
+
+TEST(Parker, WakeParkedThread) {
+    Parker parker;
+    std::atomic_bool woken = false;
+
+    std::thread sleeper([&parker, &woken]() {
+        parker.Park();
+        woken = true;
+    });
+
+    // Give the thread the time to actually sleep on the futex
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(woken);
+
+    parker.Unpark();
+    sleeper.join();
+
+    EXPECT_TRUE(woken);
+}
+
+TEST(Parker, PingPong) {
+    constexpr int kRounds = 10000;
+
+    Parker ping;
+    Parker pong;
+    int counter = 0;
+
+    std::thread other([&]() {
+        for (int i = 0; i < kRounds; i++) {
+            ping.Park();
+            counter++;
+            pong.Unpark();
+        }
+    });
+
+    // Every wakeup must be delivered, a lost one hangs the test
+    for (int i = 0; i < kRounds; i++) {
+        ping.Unpark();
+        pong.Park();
+    }
+
+    other.join();
+
+    EXPECT_EQ(counter, kRounds);
+}
+
+TEST(Parker, OneParkerPerThread) {
+    constexpr int kThreads = 8;
+
+    Parker parkers[kThreads];
+    std::atomic_int woken = 0;
+    std::vector<std::thread> threads;
+
+    for (auto &parker: parkers) {
+        threads.emplace_back([&parker, &woken]() {
+            parker.Park();
+            woken++;
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // A wakeup targets exactly one thread
+    for (int i = 0; i < kThreads; i++) {
+        parkers[i].Unpark();
+
+        while (woken < i + 1)
+            std::this_thread::yield();
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        EXPECT_EQ(woken, i + 1);
+    }
+
+    for (auto &thread: threads)
+        thread.join();
+}
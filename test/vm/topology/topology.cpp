@@ -0,0 +1,190 @@
+// This source file is part of the Argon project.
+//
+// Licensed under the Apache License v2.0
+
+#include <gtest/gtest.h>
+
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <argon/util/macros.h>
+
+#ifdef _ARGON_PLATFORM_LINUX
+
+#include <sched.h>
+
+#endif
+
+#include <argon/vm/topology.h>
+
+using namespace argon::vm;
+
+// Two NUMA nodes with four CPUs each, as returned by TopologyGetCPUs
+const CPUInfo kTwoNodes[] = {{0, 0}, {2, 0}, {4, 0}, {6, 0}, {1, 1}, {3, 1}, {5, 1}, {7, 1}};
+
+std::vector<unsigned int> Victims(const std::vector<int> &nodes, unsigned int thief, unsigned int start) {
+    std::vector<unsigned int> visited;
+
+    TopologyVisitVictims((unsigned int) nodes.size(),
+                         TopologyCountNodes(kTwoNodes, 8, (unsigned int) nodes.size()),
+                         thief, start,
+                         [&nodes](unsigned int index) { return nodes[index]; },
+                         [&visited](unsigned int index) {
+                             visited.push_back(index);
+                             return false;
+                         });
+
+    return visited;
+}
+
+TEST(Topology, GetCPUs) {
+    CPUInfo cpus[kTopologyMaxCPUs];
+
+    auto count = TopologyGetCPUs(cpus, kTopologyMaxCPUs);
+    ASSERT_GT(count, 0);
+
+    std::set<int> seen;
+    for (unsigned int i = 0; i < count; i++) {
+        EXPECT_GE(cpus[i].cpu, 0);
+        EXPECT_GE(cpus[i].node, 0);
+        EXPECT_TRUE(seen.insert(cpus[i].cpu).second);
+
+        // Grouped by node
+        if (i > 0)
+            EXPECT_LE(cpus[i - 1].node, cpus[i].node);
+    }
+
+    EXPECT_EQ(TopologyGetCPUs(cpus, 1), 1);
+}
+
+TEST(Topology, Assign) {
+    // Contiguous VCores share the same node, the CPUs are assigned again when there are more VCores than CPUs
+    for (unsigned int i = 0; i < 16; i++) {
+        auto info = TopologyAssign(i, kTwoNodes, 8);
+
+        EXPECT_EQ(info.cpu, kTwoNodes[i % 8].cpu);
+        EXPECT_EQ(info.node, i % 8 < 4 ? 0 : 1);
+    }
+
+    EXPECT_EQ(TopologyCountNodes(kTwoNodes, 8, 8), 2);
+    EXPECT_EQ(TopologyCountNodes(kTwoNodes, 8, 16), 2);
+
+    // The VCores use only the CPUs of the first node
+    EXPECT_EQ(TopologyCountNodes(kTwoNodes, 8, 4), 1);
+}
+
+TEST(Topology, UnknownTopology) {
+    // No affinity or no information: no CPU, a single node
+    auto info = TopologyAssign(3, nullptr, 0);
+
+    EXPECT_EQ(info.cpu, -1);
+    EXPECT_EQ(info.node, 0);
+
+    EXPECT_EQ(TopologyCountNodes(nullptr, 0, 8), 1);
+
+    EXPECT_FALSE(TopologyPinThread(-1));
+}
+
+TEST(Topology, StealSameNodeFirst) {
+    const std::vector<int> nodes = {0, 0, 0, 0, 1, 1, 1, 1};
+
+    for (unsigned int start = 0; start < 8; start++) {
+        auto visited = Victims(nodes, 1, start);
+
+        // Every other VCore is visited exactly once, the ones on the node of the thief first
+        ASSERT_EQ(visited.size(), 7);
+        EXPECT_EQ(std::set<unsigned int>(visited.begin(), visited.end()).size(), 7);
+
+        for (unsigned int i = 0; i < 7; i++) {
+            EXPECT_NE(visited[i], 1);
+            EXPECT_EQ(nodes[visited[i]], i < 3 ? 0 : 1);
+        }
+    }
+}
+
+TEST(Topology, StealStopsOnSuccess) {
+    const std::vector<int> nodes = {0, 0, 0, 0, 1, 1, 1, 1};
+    const std::set<unsigned int> busy = {2, 5};
+
+    for (unsigned int start = 0; start < 8; start++) {
+        int taken = -1;
+
+        // Work is available on both nodes: the victim on the node of the thief is always chosen
+        EXPECT_TRUE(TopologyVisitVictims(8, 2, 0, start,
+                                         [&nodes](unsigned int index) { return nodes[index]; },
+                                         [&busy, &taken](unsigned int index) {
+                                             if (busy.count(index) == 0)
+                                                 return false;
+
+                                             taken = (int) index;
+                                             return true;
+                                         }));
+        EXPECT_EQ(taken, 2);
+
+        // Only the remote node has work
+        EXPECT_TRUE(TopologyVisitVictims(8, 2, 0, start,
+                                         [&nodes](unsigned int index) { return nodes[index]; },
+                                         [&taken](unsigned int index) {
+                                             taken = (int) index;
+                                             return index == 6;
+                                         }));
+        EXPECT_EQ(taken, 6);
+    }
+
+    EXPECT_FALSE(TopologyVisitVictims(8, 2, 0, 0,
+                                      [&nodes](unsigned int index) { return nodes[index]; },
+                                      [](unsigned int) { return false; }));
+}
+
+TEST(Topology, StealSingleNode) {
+    // A single node (or an unknown topology): one pass over all the other VCores
+    for (unsigned int start = 0; start < 4; start++) {
+        std::vector<unsigned int> visited;
+
+        TopologyVisitVictims(4, 1, 2, start,
+                             [](unsigned int) { return 0; },
+                             [&visited](unsigned int index) {
+                                 visited.push_back(index);
+                                 return false;
+                             });
+
+        ASSERT_EQ(visited.size(), 3);
+        EXPECT_EQ(visited[0], start == 2 ? 3 : start);
+        EXPECT_EQ(std::set<unsigned int>(visited.begin(), visited.end()), (std::set<unsigned int>{0, 1, 3}));
+    }
+
+    // Nothing to steal from
+    EXPECT_FALSE(TopologyVisitVictims(1, 1, 0, 0,
+                                      [](unsigned int) { return 0; },
+                                      [](unsigned int) { return true; }));
+}
+
+TEST(Topology, PinThread) {
+    CPUInfo cpus[kTopologyMaxCPUs];
+
+    auto count = TopologyGetCPUs(cpus, kTopologyMaxCPUs);
+    ASSERT_GT(count, 0);
+
+    auto cpu = cpus[count - 1].cpu;
+
+    // Pin a separate thread, the affinity of the test runner is left untouched
+    std::thread pinned([cpu]() {
+#if defined(_ARGON_PLATFORM_LINUX)
+        ASSERT_TRUE(TopologyPinThread(cpu));
+
+        cpu_set_t set;
+        CPU_ZERO(&set);
+
+        ASSERT_EQ(sched_getaffinity(0, sizeof(cpu_set_t), &set), 0);
+        EXPECT_EQ(CPU_COUNT(&set), 1);
+        EXPECT_TRUE(CPU_ISSET(cpu, &set));
+#elif defined(_ARGON_PLATFORM_DARWIN)
+        EXPECT_FALSE(TopologyPinThread(cpu));
+#else
+        EXPECT_TRUE(TopologyPinThread(cpu));
+#endif
+    });
+
+    pinned.join();
+}